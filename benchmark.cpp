@@ -0,0 +1,566 @@
+// benchmark.cpp : Times each family of easy_list operations across element types and list sizes, counting the allocations they make.
+//
+// Build with GCC or Clang (template_helpers.h comes from cpp-template-helpers):
+//     g++ -std=c++17 -O2 -DNDEBUG -I<path to cpp-template-helpers> benchmark.cpp -o benchmark -pthread
+// or with the benchmark project in easylist.sln.
+//
+// Run:
+//     benchmark [--filter <text>] [--max-size <n>] [--min-time <ms>] [--json <file>] [--baseline <file>] [--threshold <percent>]
+//
+// --filter only runs benchmarks whose name or element type contains the text. --json writes the results, and --baseline compares them
+// against results written earlier, exiting with 1 if any benchmark got slower by more than the threshold (10% by default), or made
+// more allocations.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "easy_list.h"
+
+using namespace easy_list;
+
+///////////////////////////
+/// ALLOCATION COUNTING ///
+///////////////////////////
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE
+#endif
+
+namespace
+{
+    std::atomic<size_t> allocationCount{ 0 };
+    std::atomic<size_t> allocatedBytes{ 0 };
+
+    // Every replaced operator new allocates through allocate or allocateAligned, and every operator delete frees through the matching
+    // release, so memory is always freed the way it was allocated. They aren't inlined, so the compiler never sees a new-expression's
+    // pointer reach std::free directly.
+    BENCHMARK_NOINLINE void* allocate(const size_t size) noexcept
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    BENCHMARK_NOINLINE void release(void* memory) noexcept
+    {
+        std::free(memory);
+    }
+
+    BENCHMARK_NOINLINE void* allocateAligned(const size_t size, const std::align_val_t alignment) noexcept
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        const size_t align = (size_t)alignment;
+#if defined(_MSC_VER)
+        return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc wants a size that is a multiple of the alignment
+        return std::aligned_alloc(align, (size + align - 1) / align * align + (size == 0 ? align : 0));
+#endif
+    }
+
+    BENCHMARK_NOINLINE void releaseAligned(void* memory) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    void* allocateOrThrow(const size_t size)
+    {
+        if (void* memory = allocate(size))
+            return memory;
+        throw std::bad_alloc();
+    }
+
+    void* allocateAlignedOrThrow(const size_t size, const std::align_val_t alignment)
+    {
+        if (void* memory = allocateAligned(size, alignment))
+            return memory;
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return allocateAlignedOrThrow(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocateAlignedOrThrow(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocateAligned(size, alignment); }
+
+void operator delete(void* memory) noexcept { release(memory); }
+void operator delete[](void* memory) noexcept { release(memory); }
+void operator delete(void* memory, size_t) noexcept { release(memory); }
+void operator delete[](void* memory, size_t) noexcept { release(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { release(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { release(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { releaseAligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { releaseAligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { releaseAligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { releaseAligned(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { releaseAligned(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { releaseAligned(memory); }
+
+
+/////////////////////
+/// ELEMENT TYPES ///
+/////////////////////
+
+struct Record
+{
+    int id;
+    double score;
+    std::string name;
+
+    bool operator==(const Record& other) const { return id == other.id; }
+    bool operator<(const Record& other) const { return id < other.id; }
+    int getId() const { return id; }
+    std::string getName() const { return name; }
+};
+
+// How to make, match and transform each element type. Elements are spread over [0, size), so about half pass pick(), and
+// missing() is never in a list.
+template <typename _Type> struct sample;
+
+template <> struct sample<int>
+{
+    static const char* name() { return "int"; }
+    static int make(std::mt19937& random, size_t size) { return (int)(random() % size); }
+    static int missing() { return -1; }
+    static bool pick(int value, size_t size) { return (size_t)value < size / 2; }
+    static int transform(int value) { return value * 3 + 1; }
+};
+
+template <> struct sample<double>
+{
+    static const char* name() { return "double"; }
+    static double make(std::mt19937& random, size_t size) { return std::uniform_real_distribution<double>(0, (double)size)(random); }
+    static double missing() { return -1.0; }
+    static bool pick(double value, size_t size) { return value < size / 2.0; }
+    static double transform(double value) { return value * 0.5; }
+};
+
+template <> struct sample<std::string>
+{
+    static const char* name() { return "string"; }
+    static std::string make(std::mt19937& random, size_t size) { return "key" + std::to_string(random() % size); }
+    static std::string missing() { return "missing"; }
+    static bool pick(const std::string& value, size_t) { return value.size() % 2 == 0; }
+    static std::string transform(const std::string& value) { return value + "!"; }
+};
+
+template <> struct sample<Record>
+{
+    static const char* name() { return "Record"; }
+    static Record make(std::mt19937& random, size_t size)
+    {
+        const int id = (int)(random() % size);
+        return Record{ id, id * 0.25, "record" + std::to_string(id) };
+    }
+    static Record missing() { return Record{ -1, 0, "" }; }
+    static bool pick(const Record& value, size_t size) { return (size_t)value.id < size / 2; }
+    static Record transform(const Record& value) { return Record{ value.id + 1, value.score, value.name }; }
+};
+
+
+/////////////////
+/// MEASURING ///
+/////////////////
+
+struct Result
+{
+    std::string name;
+    std::string type;
+    size_t size;
+    double nsPerElement;
+    double allocations;
+    double bytes;
+};
+
+struct Options
+{
+    std::string filter;
+    size_t maxSize = 10000000;
+    std::chrono::milliseconds minTime{ 50 };
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 0.10;
+};
+
+// Stops the compiler from optimising away a result that is never used
+template <typename _Type>
+void keep(const _Type& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+class Bench
+{
+public:
+    explicit Bench(const Options& options) : options(options) {}
+
+    // Times the operation, running it in doubling batches until the batches add up to the minimum time, and reports the time per
+    // element of the input list along with the allocations per run. Operations whose output grows faster than their input only run
+    // up to the given size.
+    template <typename _Operation>
+    void run(const std::string& name, const std::string& type, const size_t size, _Operation operation, const size_t sizeLimit = SIZE_MAX)
+    {
+        if (size > sizeLimit || size > this->options.maxSize)
+            return;
+        if (!this->options.filter.empty() && name.find(this->options.filter) == std::string::npos && type.find(this->options.filter) == std::string::npos)
+            return;
+
+        using clock = std::chrono::steady_clock;
+        keep(operation());
+
+        const size_t allocationsBefore = allocationCount.load();
+        const size_t bytesBefore = allocatedBytes.load();
+        clock::duration elapsed = clock::duration::zero();
+        size_t runs = 0;
+        for (size_t batch = 1; elapsed < this->options.minTime; batch *= 2)
+        {
+            const clock::time_point start = clock::now();
+            for (size_t i = 0; i < batch; i++)
+                keep(operation());
+            elapsed += clock::now() - start;
+            runs += batch;
+        }
+
+        Result result;
+        result.name = name;
+        result.type = type;
+        result.size = size;
+        result.nsPerElement = std::chrono::duration<double, std::nano>(elapsed).count() / ((double)runs * (double)size);
+        result.allocations = (double)(allocationCount.load() - allocationsBefore) / (double)runs;
+        result.bytes = (double)(allocatedBytes.load() - bytesBefore) / (double)runs;
+        std::printf("%-22s %-8s %10zu %14.3f %12.1f %14.0f\n", name.c_str(), type.c_str(), size, result.nsPerElement, result.allocations, result.bytes);
+        std::fflush(stdout);
+        this->results.push_back(result);
+    }
+
+    const std::vector<Result>& all() const { return this->results; }
+
+private:
+    const Options& options;
+    std::vector<Result> results;
+};
+
+
+//////////////////
+/// BENCHMARKS ///
+//////////////////
+
+template <typename _Type>
+list<_Type> makeList(const size_t size, const unsigned seed)
+{
+    std::mt19937 random(seed);
+    list<_Type> made;
+    made.reserve(size);
+    for (size_t i = 0; i < size; i++)
+        made.push_back(sample<_Type>::make(random, size));
+    return made;
+}
+
+// The operation families every element type has
+template <typename _Type>
+void runCommon(Bench& bench, const size_t size)
+{
+    using S = sample<_Type>;
+    const std::string type = S::name();
+    const list<_Type> data = makeList<_Type>(size, 42);
+    const _Type missing = S::missing();
+    const _Type present = data[(long)(size / 2)];
+    const auto pick = [size](const _Type& value) -> bool { return S::pick(value, size); };
+
+    std::vector<size_t> everyTenth;
+    for (size_t i = 0; i < size; i += 10)
+        everyTenth.push_back(i);
+
+    bench.run("copy", type, size, [&] { return list<_Type>(data); });
+    bench.run("search", type, size, [&] { return data.search(missing); });
+    bench.run("contains", type, size, [&] { return data.contains(missing); });
+    bench.run("count", type, size, [&] { return data.count(present); });
+    bench.run("select", type, size, [&] { return data.select(pick); });
+    bench.run("removeAll", type, size, [&] { return data.removeAll(pick); });
+    bench.run("removeAt", type, size, [&] { return data.removeAt((long)(size / 2)); });
+    bench.run("removeAt (indices)", type, size, [&] { return data.removeAt(everyTenth); });
+    bench.run("transform", type, size, [&] { return data.template transform<_Type>(&S::transform); });
+    bench.run("replace", type, size, [&] { return data.replace(missing, pick); });
+    bench.run("copy+sort", type, size, [&] { list<_Type> sorted = data; sorted.sort(); return sorted; });
+    bench.run("copy+shuffle", type, size, [&] { list<_Type> shuffled = data; shuffled.shuffle(); return shuffled; });
+    bench.run("slice", type, size, [&] { return data.slice((long)(size / 4), (long)(size / 2)); });
+    bench.run("substrings(3)", type, size, [&] { return data.substrings(3); }, 1000000);
+    bench.run("substrings", type, size, [&] { return data.substrings(); }, 100);
+    bench.run("powerSet", type, size, [&] { return data.powerSet(); }, 16);
+}
+
+// Lazy pipelines, parallel operations and views, each beside the eager operation it stands in for
+template <typename _Type>
+void runAlternatives(Bench& bench, const size_t size)
+{
+    using S = sample<_Type>;
+    const std::string type = S::name();
+    const list<_Type> data = makeList<_Type>(size, 42);
+    const _Type present = data[(long)(size / 2)];
+    const auto pick = [size](const _Type& value) -> bool { return S::pick(value, size); };
+
+    bench.run("select+transform", type, size, [&] { return data.select(pick).template transform<_Type>(&S::transform); });
+    bench.run("lazy select+transform", type, size, [&] { return data.lazy().select(pick).transform(&S::transform).toList(); });
+    bench.run("lazy select+count", type, size, [&] { return data.lazy().select(pick).count(); });
+    bench.run("par select", type, size, [&] { return data.par().select(pick); });
+    bench.run("par count", type, size, [&] { return data.par().count(present); });
+    bench.run("par transform", type, size, [&] { return data.par().template transform<_Type>(&S::transform); });
+    bench.run("sliceView select", type, size, [&] { return data.sliceView((long)(size / 4), (long)(size / 2)).select(pick); });
+    bench.run("reverseView count", type, size, [&] { return data.reverseView().count(present); });
+}
+
+// Sorted lists, whose lookups are binary searches. Lookups are timed over a probe of every element, so the time per element is that of one lookup
+template <typename _Type>
+void runSorted(Bench& bench, const size_t size)
+{
+    const std::string type = sample<_Type>::name();
+    const list<_Type> data = makeList<_Type>(size, 42);
+    const list<_Type> probes = makeList<_Type>(size, 7);
+    const auto sorted = data.toSorted();
+
+    bench.run("toSorted", type, size, [&] { return data.toSorted(); });
+    bench.run("sorted contains", type, size, [&] {
+        size_t found = 0;
+        for (const _Type& probe : probes)
+            found += sorted.contains(probe);
+        return found;
+    });
+}
+
+// Unify and disjoin need elements that can be hashed or ordered
+template <typename _Type>
+void runSets(Bench& bench, const size_t size)
+{
+    const std::string type = sample<_Type>::name();
+    const list<_Type> data = makeList<_Type>(size, 42);
+    const list<_Type> other = makeList<_Type>(size, 7);
+
+    bench.run("unify", type, size, [&] { return data.unify(other); });
+    bench.run("disjoin", type, size, [&] { return data.disjoin(other); });
+}
+
+template <typename _Type>
+void runFormatting(Bench& bench, const size_t size)
+{
+    const std::string type = sample<_Type>::name();
+    const list<_Type> data = makeList<_Type>(size, 42);
+
+    bench.run("string conversion", type, size, [&] { return (std::string)data; });
+    bench.run("format (limit 100)", type, size, [&] { return data.format(", ", 100); });
+}
+
+// Operations on a member of each element
+void runMembers(Bench& bench, const size_t size)
+{
+    const std::string type = "Record";
+    const list<Record> data = makeList<Record>(size, 42);
+    const int present = data[(long)(size / 2)].id;
+
+    bench.run("search (member)", type, size, [&] { return data.search(-1, &Record::id); });
+    bench.run("count (member)", type, size, [&] { return data.count(present, &Record::id); });
+    bench.run("count (method)", type, size, [&] { return data.count(present, &Record::getId); });
+    bench.run("select (member)", type, size, [&] { return data.select(present, &Record::id); });
+    bench.run("transform (member)", type, size, [&] { return data.transform<double>(&Record::score); });
+    bench.run("copy+sort (member)", type, size, [&] { list<Record> sorted = data; sorted.sort(&Record::score); return sorted; });
+    bench.run("copy+sort (int method)", type, size, [&] { list<Record> sorted = data; sorted.sort(&Record::getId); return sorted; });
+    bench.run("copy+sort (str method)", type, size, [&] { list<Record> sorted = data; sorted.sort(&Record::getName); return sorted; });
+
+    // A hash index against the linear search it replaces, over a probe of every id
+    const auto byId = data.index(&Record::id);
+    bench.run("index (member)", type, size, [&] { return data.index(&Record::id); });
+    bench.run("index contains", type, size, [&] {
+        size_t found = 0;
+        for (int id = 0; id < (int)size; id++)
+            found += byId.contains(id);
+        return found;
+    });
+    bench.run("contains (member)", type, size, [&] {
+        size_t found = 0;
+        for (int id = 0; id < (int)size; id++)
+            found += data.contains(id, &Record::id);
+        return found;
+    }, 10000);
+}
+
+
+///////////////////////
+/// JSON & BASELINE ///
+///////////////////////
+
+std::string keyOf(const std::string& name, const std::string& type, const size_t size)
+{
+    return name + "/" + type + "/" + std::to_string(size);
+}
+
+void writeJson(const std::string& path, const std::vector<Result>& results)
+{
+    std::ofstream file(path);
+    file << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[i];
+        char line[512];
+        std::snprintf(line, sizeof(line),
+            "    { \"name\": \"%s\", \"type\": \"%s\", \"size\": %zu, \"ns_per_element\": %.6g, \"allocations\": %.6g, \"bytes\": %.6g }%s\n",
+            result.name.c_str(), result.type.c_str(), result.size, result.nsPerElement, result.allocations, result.bytes,
+            i + 1 == results.size() ? "" : ",");
+        file << line;
+    }
+    file << "  ]\n}\n";
+}
+
+// Reads a field from one line of a file written by writeJson
+std::string fieldOf(const std::string& line, const std::string& key)
+{
+    const std::string label = "\"" + key + "\": ";
+    size_t from = line.find(label);
+    if (from == std::string::npos)
+        return "";
+    from += label.size();
+    if (line[from] == '"')
+        return line.substr(from + 1, line.find('"', from + 1) - from - 1);
+    return line.substr(from, line.find_first_of(",}", from) - from);
+}
+
+// Compares the results with a baseline, printing any which have regressed
+bool compareWithBaseline(const std::string& path, const std::vector<Result>& results, const double threshold)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "can't read baseline " << path << "\n";
+        return false;
+    }
+
+    std::map<std::string, Result> baseline;
+    for (std::string line; std::getline(file, line);)
+    {
+        if (line.find("\"name\"") == std::string::npos)
+            continue;
+        Result result;
+        result.name = fieldOf(line, "name");
+        result.type = fieldOf(line, "type");
+        result.size = (size_t)std::stoull(fieldOf(line, "size"));
+        result.nsPerElement = std::stod(fieldOf(line, "ns_per_element"));
+        result.allocations = std::stod(fieldOf(line, "allocations"));
+        result.bytes = std::stod(fieldOf(line, "bytes"));
+        baseline[keyOf(result.name, result.type, result.size)] = result;
+    }
+
+    size_t compared = 0;
+    size_t regressions = 0;
+    std::printf("\n%-22s %-8s %10s %14s %14s %10s\n", "regressed", "type", "size", "baseline ns", "now ns", "allocs");
+    for (const Result& result : results)
+    {
+        const auto found = baseline.find(keyOf(result.name, result.type, result.size));
+        if (found == baseline.end())
+            continue;
+        compared++;
+        const Result& before = found->second;
+        const bool slower = result.nsPerElement > before.nsPerElement * (1 + threshold);
+        const bool moreAllocations = result.allocations > before.allocations + 0.5;
+        if (slower || moreAllocations)
+        {
+            regressions++;
+            std::printf("%-22s %-8s %10zu %14.3f %14.3f %4.0f->%.0f\n", result.name.c_str(), result.type.c_str(), result.size,
+                before.nsPerElement, result.nsPerElement, before.allocations, result.allocations);
+        }
+    }
+    std::printf("%zu of %zu benchmarks compared regressed\n", regressions, compared);
+    return regressions == 0;
+}
+
+
+////////////
+/// MAIN ///
+////////////
+
+const char* const usage =
+    "usage: benchmark [--filter <text>] [--max-size <n>] [--min-time <ms>] [--json <file>] [--baseline <file>] [--threshold <percent>]\n";
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i += 2)
+    {
+        const std::string flag = argv[i];
+        if (i + 1 == argc)
+        {
+            std::cerr << "option " << flag << " needs a value\n" << usage;
+            return 2;
+        }
+        const std::string value = argv[i + 1];
+        if (flag == "--filter")
+            options.filter = value;
+        else if (flag == "--max-size")
+            options.maxSize = (size_t)std::stod(value);
+        else if (flag == "--min-time")
+            options.minTime = std::chrono::milliseconds(std::stol(value));
+        else if (flag == "--json")
+            options.jsonPath = value;
+        else if (flag == "--baseline")
+            options.baselinePath = value;
+        else if (flag == "--threshold")
+            options.threshold = std::stod(value) / 100;
+        else
+        {
+            std::cerr << "unknown option " << flag << "\n" << usage;
+            return 2;
+        }
+    }
+
+    Bench bench(options);
+    std::printf("%-22s %-8s %10s %14s %12s %14s\n", "benchmark", "type", "size", "ns/element", "allocs/run", "bytes/run");
+    for (size_t size = 10; size <= options.maxSize; size *= 10)
+    {
+        runCommon<int>(bench, size);
+        runCommon<double>(bench, size);
+        runCommon<std::string>(bench, size);
+        runCommon<Record>(bench, size);
+        runSets<int>(bench, size);
+        runSets<double>(bench, size);
+        runSets<std::string>(bench, size);
+        runFormatting<int>(bench, size);
+        runFormatting<double>(bench, size);
+        runAlternatives<int>(bench, size);
+        runAlternatives<double>(bench, size);
+        runAlternatives<std::string>(bench, size);
+        runAlternatives<Record>(bench, size);
+        runSorted<int>(bench, size);
+        runSorted<double>(bench, size);
+        runSorted<std::string>(bench, size);
+        runMembers(bench, size);
+    }
+
+    if (!options.jsonPath.empty())
+        writeJson(options.jsonPath, bench.all());
+    if (!options.baselinePath.empty() && !compareWithBaseline(options.baselinePath, bench.all(), options.threshold))
+        return 1;
+    return 0;
+}
@@ -2,503 +2,9898 @@
 #include <string>
 #include <vector>
 #include <memory>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define EASY_LIST_PMR
+#endif
 #include <type_traits>
 #include <sstream>
 #include <iterator>
 #include <algorithm>
-#include <time.h>
+#include <numeric>
+#include <chrono>
 #include <random>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <unordered_set>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define EASY_LIST_DEFINED_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef EASY_LIST_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef EASY_LIST_DEFINED_NOMINMAX
+#endif
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <climits>
+#include <typeinfo>
+#include <charconv>
+#include <fstream>
+#include <map>
+
+#if defined(_WIN32)
+#define EASY_LIST_MMAP
+#elif __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EASY_LIST_MMAP
+#endif
+
+#if !defined(EASY_LIST_NO_SIMD) && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+#define EASY_LIST_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define EASY_LIST_TARGET(isa) __attribute__((target(isa)))
+#else
+#define EASY_LIST_TARGET(isa)
+#endif
 #include <template_helpers.h>
 
-#if _HAS_CXX17
+// MSVC only reports the standard in __cplusplus with /Zc:__cplusplus, so check its own macro too
+#if _HAS_CXX17 || __cplusplus >= 201703L
 
 namespace easy_list
 {
-    /// <summary>
-    /// An ordered list with better built-in functionality than ordinary vectors.
-    /// </summary>
-    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
-    /// <typeparam name="_Alloc">The element allocator</typeparam>
-    template<class _Type, class _Alloc = std::allocator<_Type>>
-    class list : public std::vector<_Type, _Alloc>
+    namespace detail
     {
-    public:
-        using _Mybase = std::vector<_Type>;
-        template <typename _Traits> using _String = std::basic_string<_Type, _Traits, _Alloc>;
-        using value_type = _Type;
-        using allocator_type = typename _Mybase::allocator_type;
-        using size_type = typename _Mybase::size_type;
-
         /// <summary>
-        /// Search operations return this if no match was found.
+        /// Whether the given type is an iterator, which tells the iterator-pair constructor apart from the others.
         /// </summary>
-        /// <returns>An iterator object representing "no match found".</returns>
-        typename _Mybase::iterator npos() { return this->end(); }
+        template <typename _Iter, typename = void>
+        struct is_iterator : std::false_type {};
+
+        template <typename _Iter>
+        struct is_iterator<_Iter, std::void_t<typename std::iterator_traits<_Iter>::iterator_category>> : std::true_type {};
+
+        template <typename _Iter>
+        inline constexpr bool is_iterator_v = is_iterator<_Iter>::value;
 
         /// <summary>
-        /// Const search operations return this if no match was found.
+        /// Whether std::hash is enabled for the given type.
         /// </summary>
-        /// <returns>An iterator object representing "no match found".</returns>
-        typename _Mybase::const_iterator npos() const { return this->end(); }
+        template <typename _Type, typename = void>
+        struct is_hashable : std::false_type {};
 
-        ////////////////////
-        /// CONSTRUCTORS ///
-        ////////////////////
+        template <typename _Type>
+        struct is_hashable<_Type, std::void_t<decltype(std::hash<_Type>{}(std::declval<const _Type&>()))>>
+            : std::is_convertible<decltype(std::hash<_Type>{}(std::declval<const _Type&>())), size_t> {};
 
-        list() : _Mybase() {}
+        template <typename _Type>
+        inline constexpr bool is_hashable_v = is_hashable<_Type>::value;
 
-        explicit list(const _Alloc& _Al) : _Mybase(_Al) {}
+        /// <summary>
+        /// Whether the given type can be ordered with the < operator.
+        /// </summary>
+        template <typename _Type, typename = void>
+        struct is_less_comparable : std::false_type {};
 
-        list(const size_t _Count, const _Type& _Val, const _Alloc& _Al = _Alloc()) : _Mybase(_Count, _Val, _Al) {}
+        template <typename _Type>
+        struct is_less_comparable<_Type, std::void_t<decltype(std::declval<const _Type&>() < std::declval<const _Type&>())>>
+            : std::is_convertible<decltype(std::declval<const _Type&>() < std::declval<const _Type&>()), bool> {};
 
-        template <class _Iter, std::enable_if_t<std::_Is_iterator_v<_Iter>, bool> = true>
-        list(_Iter _First, _Iter _Last, const _Alloc& _Al = _Alloc()) : _Mybase(_First, _Last, _Al) {}
+        template <typename _Type>
+        inline constexpr bool is_less_comparable_v = is_less_comparable<_Type>::value;
 
-        list(std::initializer_list<_Type> _Ilist, const _Alloc& _Al = _Alloc()) : _Mybase(_Ilist, _Al) {}
+        /// <summary>
+        /// The algorithm used by set-like operations (unify, disjoin, removeDuplicates), chosen from the traits of the element type.
+        /// </summary>
+        enum class set_engine { hashed, sorted, linear };
 
-        list(const list& _Right, const _Alloc& _Al = _Alloc()) : _Mybase((const _Mybase&)_Right, _Al) {}
-        list(const _Mybase& _Right, const _Alloc& _Al = _Alloc()) : _Mybase(_Right, _Al) {}
-        template<typename _Traits> list(const _String<_Traits>& _Right, const _Alloc& _Al = _Alloc()) : _Mybase(_Right.begin(), _Right.end(), _Al) {}
+        template <typename _Type>
+        inline constexpr set_engine set_engine_v =
+            (is_hashable_v<_Type> && template_helpers::is_equatable_v<const _Type&, const _Type&>) ? set_engine::hashed
+            : is_less_comparable_v<_Type> ? set_engine::sorted
+            : set_engine::linear;
 
-        list(list&& _Right, const _Alloc& _Al = _Alloc()) noexcept : _Mybase((_Mybase&&)_Right, _Al) {}
-        list(_Mybase&& _Right, const _Alloc& _Al = _Alloc()) noexcept : _Mybase(_Right, _Al) {}
-        template<typename _Traits> list(_String<_Traits>&& _Right, const _Alloc& _Al = _Alloc()) noexcept : _Mybase(_Right.begin(), _Right.end(), _Al) {}
+        /// <summary>
+        /// Hashes an element through a pointer to it, so that hash sets needn't copy elements.
+        /// </summary>
+        template <typename _Type>
+        struct indirect_hash
+        {
+            size_t operator()(const _Type* elem) const { return std::hash<_Type>{}(*elem); }
+        };
 
-        ~list() { }
+        /// <summary>
+        /// Compares two elements for equality through pointers to them.
+        /// </summary>
+        template <typename _Type>
+        struct indirect_equal
+        {
+            bool operator()(const _Type* lhs, const _Type* rhs) const { return *lhs == *rhs; }
+        };
 
+        template <typename _Type>
+        using indirect_set = std::unordered_set<const _Type*, indirect_hash<_Type>, indirect_equal<_Type>>;
 
-        //////////////////////////
-        /// OPERATOR OVERLOADS ///
-        //////////////////////////
+        /// <summary>
+        /// Removes all but the first occurrence of each element from a sequence of element pointers, preserving order.
+        /// </summary>
+        /// <param name="seq">The sequence to filter in place.</param>
+        template <typename _Type>
+        void unique_first_occurrences(std::vector<const _Type*>& seq)
+        {
+            if constexpr (set_engine_v<_Type> == set_engine::hashed)
+            {
+                indirect_set<_Type> seen;
+                seen.reserve(seq.size());
+                seq.erase(
+                    std::remove_if(seq.begin(), seq.end(), [&seen](const _Type* elem) -> bool { return !seen.insert(elem).second; }),
+                    seq.end()
+                );
+            }
+            else if constexpr (set_engine_v<_Type> == set_engine::sorted)
+            {
+                // Stable sort positions by value, so the first of each run of equivalent values is its first occurrence
+                std::vector<size_t> order(seq.size());
+                for (size_t i = 0; i < order.size(); i++)
+                    order[i] = i;
+                std::stable_sort(order.begin(), order.end(), [&seq](size_t lhs, size_t rhs) -> bool { return *seq[lhs] < *seq[rhs]; });
 
-        list& operator=(const list& rhs) {
-            _Mybase::operator=((const _Mybase&)rhs);
-            return *this;
-        }
-        list& operator=(const _Mybase& rhs) {
-            _Mybase::operator=(rhs);
-            return *this;
-        }
-        template<typename _Traits>
-        list& operator=(const _String<_Traits>& rhs) {
-            return operator=(list(rhs));
-        }
+                std::vector<bool> keep(seq.size(), false);
+                for (size_t i = 0; i < order.size(); i++)
+                {
+                    if (i == 0 || *seq[order[i - 1]] < *seq[order[i]])
+                        keep[order[i]] = true;
+                }
 
-        list& operator=(list&& rhs) noexcept {
-            _Mybase::operator=((_Mybase&&)rhs);
-            return *this;
-        }
-        list& operator=(_Mybase&& rhs) noexcept {
-            _Mybase::operator=(rhs);
-            return *this;
+                size_t out = 0;
+                for (size_t i = 0; i < seq.size(); i++)
+                {
+                    if (keep[i])
+                        seq[out++] = seq[i];
+                }
+                seq.resize(out);
+            }
+            else
+            {
+                size_t out = 0;
+                for (size_t i = 0; i < seq.size(); i++)
+                {
+                    bool seen = false;
+                    for (size_t j = 0; j < out && !seen; j++)
+                        seen = *seq[j] == *seq[i];
+                    if (!seen)
+                        seq[out++] = seq[i];
+                }
+                seq.resize(out);
+            }
         }
-        template<typename _Traits>
-        list& operator=(_String<_Traits>&& rhs) {
-            return operator=(list(rhs));
+        /// <summary>
+        /// Removes from a sequence of element pointers every element not occurring in the given range, preserving order.
+        /// </summary>
+        /// <param name="seq">The sequence to filter in place.</param>
+        /// <param name="first">An iterator to the first element of the range.</param>
+        /// <param name="last">An iterator to the element after the last of the range.</param>
+        template <typename _Type, typename _Iter>
+        void keep_occurring_in(std::vector<const _Type*>& seq, const _Iter first, const _Iter last)
+        {
+            if constexpr (set_engine_v<_Type> == set_engine::hashed)
+            {
+                indirect_set<_Type> members;
+                members.reserve((size_t)std::distance(first, last));
+                for (_Iter iter = first; iter != last; ++iter)
+                    members.insert(&*iter);
+                seq.erase(
+                    std::remove_if(seq.begin(), seq.end(), [&members](const _Type* elem) -> bool { return members.count(elem) == 0; }),
+                    seq.end()
+                );
+            }
+            else if constexpr (set_engine_v<_Type> == set_engine::sorted)
+            {
+                std::vector<const _Type*> members;
+                members.reserve((size_t)std::distance(first, last));
+                for (_Iter iter = first; iter != last; ++iter)
+                    members.push_back(&*iter);
+                auto less = [](const _Type* lhs, const _Type* rhs) -> bool { return *lhs < *rhs; };
+                std::sort(members.begin(), members.end(), less);
+                seq.erase(
+                    std::remove_if(seq.begin(), seq.end(), [&members, less](const _Type* elem) -> bool { return !std::binary_search(members.begin(), members.end(), elem, less); }),
+                    seq.end()
+                );
+            }
+            else
+            {
+                seq.erase(
+                    std::remove_if(seq.begin(), seq.end(), [first, last](const _Type* elem) -> bool { return std::find(first, last, *elem) == last; }),
+                    seq.end()
+                );
+            }
         }
+    }
 
+    /// <summary>
+    /// A work-stealing pool of threads, shared by every parallel operation in the process.
+    /// Each worker has its own queue of tasks, which it runs newest-first; when its queue is empty, it steals the oldest task from another queue.
+    /// Threads waiting on parallel work run queued tasks while they wait, so parallel operations may be nested (for instance, a parallel
+    /// transform whose transformer itself calls par()) without deadlocking or creating more threads.
+    /// </summary>
+    class thread_pool
+    {
+    public:
         /// <summary>
-        /// Concatenates two lists, or a list and a vector.
+        /// The pool used by all easy_list parallel operations. Created on first use, with one worker fewer than the number of hardware threads,
+        /// since the thread starting a parallel operation also works on it.
         /// </summary>
-        /// <param name="rhs">The other vector to concatenate.</param>
-        /// <returns>The concatenated list.</returns>
-        list operator+(const _Mybase& rhs) const {
-            list result = list(*this);
-            for (_Type elem : rhs) result.push_back(elem);
-            return result;
+        static thread_pool& shared()
+        {
+            static thread_pool pool(std::max(1u, std::thread::hardware_concurrency()) - 1, false);
+            return pool;
         }
 
+        thread_pool(const size_t workers, const bool pinned) { this->start(workers, pinned); }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() { this->stop(); }
+
         /// <summary>
-        /// Concatenates this list with a single item.
+        /// Replaces the workers of this pool. Waits for every parallel operation already running on the pool to finish, and holds back
+        /// any that start meanwhile until the new workers are running. Throws std::logic_error if called from inside a parallel operation
+        /// (from a worker, or from a task or callback run by one), since that operation could then never finish.
         /// </summary>
-        /// <param name="rhs">The item to concatenate.</param>
-        /// <returns>The concatenated list.</returns>
-        list operator+(const _Type& rhs) const {
-            auto result = list(*this);
-            result.push_back(rhs);
-            return result;
+        /// <param name="workers">The number of worker threads. Zero means that parallel operations run entirely on the calling thread.</param>
+        /// <param name="pinned">Whether to pin each worker to its own core, where the platform supports it.</param>
+        void configure(const size_t workers, const bool pinned = false)
+        {
+            if (currentPool == this || operationDepth > 0)
+                throw std::logic_error("thread_pool::configure called from inside a parallel operation");
+
+            std::unique_lock<std::mutex> lock(this->useMutex);
+            this->idle.wait(lock, [this]() -> bool { return !this->configuring; });
+            this->configuring = true;
+            this->idle.wait(lock, [this]() -> bool { return this->users == 0; });
+            lock.unlock();
+
+            this->stop();
+            this->start(workers, pinned);
+
+            lock.lock();
+            this->configuring = false;
+            lock.unlock();
+            this->idle.notify_all();
         }
 
         /// <summary>
-        /// Appends (concatenates) a list or vector on the end of the current list.
+        /// The number of worker threads in this pool.
         /// </summary>
-        /// <param name="rhs">The vector to append.</param>
-        /// <returns>The list, after the append operation.</returns>
-        list& operator+=(const _Mybase& rhs) {
-            this->insert(this->end(), rhs.begin(), rhs.end());
-            return *this;
+        [[nodiscard]] size_t workers() const { return this->workerCount.load(std::memory_order_relaxed); }
+
+        /// <summary>
+        /// Marks the lifetime of a parallel operation on a pool, so that configure waits for it. Nested operations (started from a worker,
+        /// or from inside another operation on the same thread) are already covered by the outermost one and are not counted again.
+        /// </summary>
+        class operation
+        {
+        public:
+            explicit operation(thread_pool& pool) : pool(pool), counted(currentPool != &pool && operationDepth == 0)
+            {
+                if (this->counted)
+                {
+                    std::unique_lock<std::mutex> lock(pool.useMutex);
+                    pool.idle.wait(lock, [&pool]() -> bool { return !pool.configuring; });
+                    pool.users++;
+                }
+                operationDepth++;
+            }
+
+            operation(const operation&) = delete;
+            operation& operator=(const operation&) = delete;
+
+            ~operation()
+            {
+                operationDepth--;
+                if (this->counted)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(this->pool.useMutex);
+                        this->pool.users--;
+                    }
+                    this->pool.idle.notify_all();
+                }
+            }
+
+        private:
+            thread_pool& pool;
+            const bool counted;
+        };
+
+        /// <summary>
+        /// Queues a task. From a worker of this pool, the task goes on that worker's own queue; from any other thread, it goes on the shared queue.
+        /// </summary>
+        /// <param name="task">The task to run.</param>
+        void submit(std::function<void()> task)
+        {
+            queue& target = *this->queues[this->ownQueue()];
+            {
+                std::lock_guard<std::mutex> lock(target.mutex);
+                target.tasks.push_back(std::move(task));
+            }
+            this->pending.fetch_add(1);
+            {
+                std::lock_guard<std::mutex> lock(this->sleepMutex);
+            }
+            this->wake.notify_one();
         }
 
         /// <summary>
-        /// Appends (concatenates) a single item on the end of the current list.
+        /// Runs one queued task on the calling thread, if there is one. Used by threads waiting on parallel work, so that they help rather
+        /// than block while there is work to do.
         /// </summary>
-        /// <param name="rhs">The item to append.</param>
-        /// <returns>This list, after the append operation.</returns>
-        list& operator+=(const _Type& rhs) {
-            this->push_back(rhs);
-            return *this;
+        /// <returns>True if a task was run, false if there was nothing to do.</returns>
+        bool runPending()
+        {
+            std::function<void()> task;
+            if (!this->take(this->ownQueue(), task))
+                return false;
+            task();
+            return true;
         }
 
     private:
-        std::string getTypeName() const
+        struct queue
         {
-            std::string str = "easy_list::list<";
-            str += typeid(_Type).name();
-            str += ">";
-            return str;
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        // One queue per worker, followed by a queue for tasks submitted from outside the pool
+        std::vector<std::unique_ptr<queue>> queues;
+        std::vector<std::thread> threads;
+        std::atomic<size_t> pending{ 0 };
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        bool stopping = false;
+        std::atomic<size_t> workerCount{ 0 };
+
+        // Outermost parallel operations running on the pool, and whether configure is waiting for them or replacing the workers
+        std::mutex useMutex;
+        std::condition_variable idle;
+        size_t users = 0;
+        bool configuring = false;
+
+        inline static thread_local const thread_pool* currentPool = nullptr;
+        inline static thread_local size_t currentWorker = 0;
+        inline static thread_local size_t operationDepth = 0;
+
+        size_t ownQueue() const
+        {
+            return (currentPool == this ? currentWorker : this->threads.size());
         }
 
-    public:
-        template <typename = typename std::enable_if_t<template_helpers::can_convert_string<_Type>::value, bool>>
-        operator std::string() const
+        bool take(const size_t home, std::function<void()>& task)
         {
-            std::string str = getTypeName();
-            str += ": (";
-            if (_Mybase::size() != 0)
+            // Newest task from our own queue first, as its data is most likely still in cache
             {
-                for (_Type elem : *this)
-                    str += template_helpers::convert_string(elem) + ", ";
-                str = str.substr(0, str.length() - 2);
+                queue& own = *this->queues[home];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty())
+                {
+                    task = std::move(own.tasks.back());
+                    own.tasks.pop_back();
+                    this->pending.fetch_sub(1);
+                    return true;
+                }
             }
-            str += ")";
-            return str;
+
+            // Otherwise steal the oldest task from someone else
+            for (size_t offset = 1; offset < this->queues.size(); offset++)
+            {
+                queue& victim = *this->queues[(home + offset) % this->queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    this->pending.fetch_sub(1);
+                    return true;
+                }
+            }
+            return false;
         }
 
-        template <typename = typename std::enable_if_t<template_helpers::can_convert_wstring<_Type>::value, bool>>
-        operator std::wstring() const
+        void start(const size_t workers, const bool pinned)
         {
-            std::string typeName = getTypeName();
-            std::wstring str = std::wstring(typeName.begin(), typeName.end());
-            str += L": (";
-            if (_Mybase::size() != 0)
+            this->stopping = false;
+            this->queues.clear();
+            for (size_t i = 0; i <= workers; i++)
+                this->queues.push_back(std::make_unique<queue>());
+
+            this->threads.reserve(workers);
+            for (size_t i = 0; i < workers; i++)
             {
-                for (_Type elem : *this)
-                    str += template_helpers::convert_wstring(elem) + L", ";
-                str = str.substr(0, str.length() - 2);
+                this->threads.emplace_back([this, i]() -> void { this->work(i); });
+                if (pinned)
+                    thread_pool::pin(this->threads.back(), i);
             }
-            str += L")";
-            return str;
+            this->workerCount.store(workers, std::memory_order_relaxed);
         }
 
-        friend std::ostream& operator<<(std::ostream& stream, const list list)
+        void stop()
         {
-            std::string str = list;
-            stream << str;
-            return stream;
+            {
+                std::lock_guard<std::mutex> lock(this->sleepMutex);
+                this->stopping = true;
+            }
+            this->wake.notify_all();
+            for (std::thread& thread : this->threads)
+                thread.join();
+            this->threads.clear();
+            this->workerCount.store(0, std::memory_order_relaxed);
         }
 
-        friend std::wostream& operator<<(std::wostream& stream, const list list)
+        void work(const size_t index)
         {
-            std::wstring wstr = list;
-            stream << wstr;
-            return stream;
+            currentPool = this;
+            currentWorker = index;
+            std::function<void()> task;
+            while (true)
+            {
+                if (this->take(index, task))
+                {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->sleepMutex);
+                this->wake.wait(lock, [this]() -> bool { return this->stopping || this->pending.load() > 0; });
+                if (this->stopping && this->pending.load() == 0)
+                    return;
+            }
         }
 
+        static void pin(std::thread& thread, const size_t index)
+        {
+            const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+#if defined(_WIN32)
+            SetThreadAffinityMask(thread.native_handle(), (DWORD_PTR)1 << (index % cores % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(index % cores, &cpus);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpus);
+#else
+            (void)thread;
+            (void)index;
+            (void)cores;
+#endif
+        }
+    };
 
-        ///////////////////
-        /// CONVERSIONS ///
-        ///////////////////
+    namespace detail
+    {
+        /// <summary>
+        /// Fewest elements worth handing to a task of their own.
+        /// </summary>
+        inline constexpr size_t min_parallel_chunk = 4096;
 
-        std::basic_string<_Type, std::char_traits<_Type>, _Alloc> toString() const
+        /// <summary>
+        /// How many tasks each thread should get, so that threads which finish early can steal from those which don't.
+        /// </summary>
+        inline constexpr size_t chunks_per_thread = 4;
+
+        /// <summary>
+        /// Chooses how many chunks to split a parallel operation over the given number of elements into: no chunk smaller than
+        /// min_parallel_chunk, and no more than a few per thread in the shared pool.
+        /// </summary>
+        /// <param name="count">The number of elements.</param>
+        /// <returns>The number of chunks, which is always at least one.</returns>
+        inline size_t parallel_chunk_count(const size_t count)
         {
-            return std::basic_string<_Type, std::char_traits<_Type>, _Alloc>(this->begin(), this->end());
+            const size_t threads = thread_pool::shared().workers() + 1;
+            if (threads == 1)
+                return 1;
+            return std::max<size_t>(1, std::min(threads * chunks_per_thread, count / min_parallel_chunk));
         }
 
+        /// <summary>
+        /// Splits the index range [0, count) into contiguous chunks and runs the given function on each, using the shared thread pool.
+        /// The calling thread runs the first chunk itself, then helps with queued work, and once there is none left sleeps until the rest
+        /// are done. If any chunk throws, the first exception (by chunk order) is rethrown.
+        /// </summary>
+        /// <param name="count">The number of indices to split.</param>
+        /// <param name="chunks">The number of chunks to split into, as given by parallel_chunk_count.</param>
+        /// <param name="function">A callable object taking the chunk number, and the first and one-past-last index of the chunk.</param>
+        template <typename _Function>
+        void parallel_chunks(const size_t count, const size_t chunks, const _Function& function)
+        {
+            const size_t chunkSize = (count + chunks - 1) / chunks;
+            std::vector<std::exception_ptr> errors(chunks);
+            std::mutex doneMutex;
+            std::condition_variable done;
+            size_t remaining = chunks - 1;
+            auto runChunk = [&](size_t chunk) -> void {
+                try
+                {
+                    function(chunk, std::min(count, chunk * chunkSize), std::min(count, (chunk + 1) * chunkSize));
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
 
-        /////////////////
-        /// SEARCHING ///
-        /////////////////
+            thread_pool& pool = thread_pool::shared();
+            const thread_pool::operation running(pool);
+            for (size_t chunk = 1; chunk < chunks; chunk++)
+            {
+                pool.submit([&runChunk, &doneMutex, &done, &remaining, chunk]() -> void {
+                    runChunk(chunk);
+                    // Notify while still holding the lock, so the waiting thread can't return and take these off the stack first
+                    std::lock_guard<std::mutex> lock(doneMutex);
+                    if (--remaining == 0)
+                        done.notify_all();
+                });
+            }
+            runChunk(0);
+
+            // Every chunk still to finish is either queued, so we can run it ourselves, or already running on another thread
+            std::unique_lock<std::mutex> lock(doneMutex);
+            while (remaining > 0)
+            {
+                lock.unlock();
+                const bool ran = pool.runPending();
+                lock.lock();
+                if (!ran)
+                    done.wait(lock, [&remaining]() -> bool { return remaining == 0; });
+            }
+            lock.unlock();
+
+            for (const std::exception_ptr& error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
 
         /// <summary>
-        /// Searches for an exact match.
+        /// One step of SplitMix64, which spreads a 64-bit seed into well-mixed words for seeding other generators.
         /// </summary>
-        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to search for.</param>
-        /// <returns>A const iterator to the first element found equal to the provided match.</returns>
-        template <
-            typename _MatchType,
-            std::enable_if_t<
-                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
-                bool
-            > = true
-        >
-        [[nodiscard]] typename _Mybase::const_iterator search(const _MatchType& match) const
+        /// <param name="state">The generator state, which is advanced.</param>
+        /// <returns>The next output.</returns>
+        inline std::uint64_t splitmix64(std::uint64_t& state)
         {
-            return std::find_if(
-                this->begin(),
-                this->end(),
-                [match](const _Type& other) -> bool { return other == match; }
-            );
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
         }
-        
+
         /// <summary>
-        /// Searches for an element satisfying the given predicate.
+        /// A seed which differs on every call, even between calls in the same instant: a random base for the process, mixed with a call counter.
         /// </summary>
-        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
-        /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>A const iterator to the first element found to satisfy the given predicate.</returns>
-        template <
-            typename _Predicate,
-            std::enable_if_t<
-                std::conjunction_v<
-                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
-                    template_helpers::is_predicate<_Predicate, _Type>
-                >,
-                bool
-            >
-            = true
-        >
-        [[nodiscard]] typename _Mybase::const_iterator search(const _Predicate predicate) const
+        inline std::uint64_t fresh_seed()
         {
-            return std::find_if(this->begin(), this->end(), predicate);
+            static const std::uint64_t base = ((std::uint64_t)std::random_device()() << 32)
+                ^ (std::uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+            static std::atomic<std::uint64_t> calls(0);
+            std::uint64_t state = base + calls.fetch_add(1, std::memory_order_relaxed);
+            return splitmix64(state);
         }
-        
+    }
+
+    /// <summary>
+    /// A small, fast random number generator (xoshiro256**), satisfying UniformRandomBitGenerator, and the default for list::shuffle.
+    /// The same seed always gives the same sequence, on any platform. Not for cryptographic use.
+    /// </summary>
+    class xoshiro256
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
         /// <summary>
-        /// Searches for an element with a member matching the given value.
+        /// Seeds the generator differently every time.
         /// </summary>
-        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
-        /// <param name="match">The value to check against.</param>
-        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
-        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>A const iterator to the first element found, such that the given member variable or method returned the match provided.</returns>
-        template <
-            typename _Result,
-            typename _Callable,
+        xoshiro256() : xoshiro256(detail::fresh_seed()) {}
+
+        /// <summary>
+        /// Seeds the generator reproducibly.
+        /// </summary>
+        /// <param name="seed">Any value. Similar seeds still give unrelated sequences.</param>
+        explicit xoshiro256(std::uint64_t seed)
+        {
+            for (std::uint64_t& word : this->state)
+                word = detail::splitmix64(seed);
+        }
+
+        result_type operator()()
+        {
+            const std::uint64_t result = rotl(this->state[1] * 5, 7) * 9;
+            const std::uint64_t shifted = this->state[1] << 17;
+            this->state[2] ^= this->state[0];
+            this->state[3] ^= this->state[1];
+            this->state[1] ^= this->state[2];
+            this->state[0] ^= this->state[3];
+            this->state[2] ^= shifted;
+            this->state[3] = rotl(this->state[3], 45);
+            return result;
+        }
+
+        /// <summary>
+        /// Advances the generator by 2^128 steps. Jumping copies of one generator different numbers of times gives sequences which
+        /// don't overlap, one for each thread.
+        /// </summary>
+        void jump()
+        {
+            constexpr std::uint64_t polynomial[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+            std::uint64_t jumped[4] = { 0, 0, 0, 0 };
+            for (const std::uint64_t word : polynomial)
+            {
+                for (int bit = 0; bit < 64; bit++)
+                {
+                    if (word & (1ull << bit))
+                    {
+                        for (int i = 0; i < 4; i++)
+                            jumped[i] ^= this->state[i];
+                    }
+                    (*this)();
+                }
+            }
+            std::memcpy(this->state, jumped, sizeof(this->state));
+        }
+
+        friend bool operator==(const xoshiro256& lhs, const xoshiro256& rhs) { return std::memcmp(lhs.state, rhs.state, sizeof(lhs.state)) == 0; }
+        friend bool operator!=(const xoshiro256& lhs, const xoshiro256& rhs) { return !(lhs == rhs); }
+
+    private:
+        static std::uint64_t rotl(const std::uint64_t value, const int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+        std::uint64_t state[4];
+    };
+
+    namespace detail
+    {
+        /// <summary>
+        /// Whether the given type can be used as a random number generator for shuffling.
+        /// </summary>
+        template <typename _Generator, typename = void>
+        struct is_uniform_random_bit_generator : std::false_type {};
+
+        template <typename _Generator>
+        struct is_uniform_random_bit_generator<_Generator, std::void_t<
+            typename _Generator::result_type,
+            decltype(_Generator::min()),
+            decltype(_Generator::max()),
+            decltype(std::declval<_Generator&>()())
+        >> : std::is_unsigned<typename _Generator::result_type> {};
+
+        template <typename _Generator>
+        inline constexpr bool is_uniform_random_bit_generator_v = is_uniform_random_bit_generator<std::decay_t<_Generator>>::value;
+
+        /// <summary>
+        /// A uniformly random number below the given bound, by Lemire's multiply-and-shift method, which avoids a division almost every time.
+        /// </summary>
+        inline std::uint64_t random_below(xoshiro256& generator, const std::uint64_t bound)
+        {
+            if (bound <= 0xFFFFFFFFull)
+            {
+                std::uint64_t product = (generator() >> 32) * bound;
+                if ((std::uint32_t)product < bound)
+                {
+                    const std::uint32_t threshold = (std::uint32_t)(0u - (std::uint32_t)bound) % (std::uint32_t)bound;
+                    while ((std::uint32_t)product < threshold)
+                        product = (generator() >> 32) * bound;
+                }
+                return product >> 32;
+            }
+
+            // Bounds this large are rare enough for plain rejection sampling
+            const std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() - std::numeric_limits<std::uint64_t>::max() % bound;
+            std::uint64_t value;
+            do
+            {
+                value = generator();
+            } while (value >= limit);
+            return value % bound;
+        }
+
+        /// <summary>
+        /// A uniformly random number below the given bound.
+        /// </summary>
+        template <typename _Generator>
+        std::uint64_t random_below(_Generator& generator, const std::uint64_t bound)
+        {
+            return std::uniform_int_distribution<std::uint64_t>(0, bound - 1)(generator);
+        }
+
+        /// <summary>
+        /// Shuffles the first positions of a run of elements by Fisher-Yates, filling each from those not yet placed. The rest are left
+        /// in no particular order.
+        /// </summary>
+        /// <param name="first">The start of the run.</param>
+        /// <param name="count">The number of elements in the run.</param>
+        /// <param name="positions">The number of positions to fill, from the front.</param>
+        /// <param name="generator">The random number generator to use.</param>
+        template <typename _Iter, typename _Generator>
+        void fisher_yates(const _Iter first, const size_t count, const size_t positions, _Generator& generator)
+        {
+            using std::swap;
+            const size_t last = std::min(positions, count == 0 ? 0 : count - 1);
+            for (size_t i = 0; i < last; i++)
+            {
+                const size_t chosen = i + (size_t)random_below(generator, count - i);
+                if (chosen != i)
+                    swap(first[i], first[chosen]);
+            }
+        }
+
+        /// <summary>
+        /// Fewest elements worth shuffling in parallel.
+        /// </summary>
+        inline constexpr size_t min_parallel_shuffle = 1 << 16;
+
+        /// <summary>
+        /// Most buckets a parallel shuffle scatters elements into.
+        /// </summary>
+        inline constexpr size_t max_shuffle_buckets = 256;
+
+        /// <summary>
+        /// A uniformly random number strictly between 0 and 1, from 53 random bits offset by half a step, so its logarithm is always finite.
+        /// </summary>
+        inline double random_unit(xoshiro256& generator)
+        {
+            return ((double)(generator() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        }
+
+        /// <summary>
+        /// A uniformly random number strictly between 0 and 1.
+        /// </summary>
+        template <typename _Generator>
+        double random_unit(_Generator& generator)
+        {
+            const std::uint64_t bits = std::uniform_int_distribution<std::uint64_t>(0, (1ull << 53) - 1)(generator);
+            return ((double)bits + 0.5) * (1.0 / 9007199254740992.0);
+        }
+
+        /// <summary>
+        /// Keeps a uniform random sample of a fixed number of the items offered to it, however many are offered, by Li's Algorithm L.
+        /// Once full, it draws how many items to pass over before the next replacement, so most items cost a comparison and no random numbers.
+        /// </summary>
+        /// <typeparam name="_Item">The type of the items kept.</typeparam>
+        /// <typeparam name="_Generator">A uniform random bit generator.</typeparam>
+        template <typename _Item, typename _Generator>
+        class reservoir
+        {
+        public:
+            reservoir(const size_t capacity, _Generator& generator)
+                : capacity(capacity), generator(&generator), offered(0), threshold(1.0), skip(capacity == 0 ? std::numeric_limits<std::uint64_t>::max() : 0) {}
+
+            /// <summary>
+            /// The number of items the reservoir will pass over next, which a caller able to jump ahead may hand to pass() instead of offering.
+            /// </summary>
+            [[nodiscard]] std::uint64_t skipping() const noexcept { return this->skip; }
+
+            /// <summary>
+            /// Passes over the given number of items, no more than skipping().
+            /// </summary>
+            void pass(const std::uint64_t count) noexcept
+            {
+                this->offered += count;
+                this->skip -= count;
+            }
+
+            /// <summary>
+            /// Offers the next item, which is only copied if it is kept.
+            /// </summary>
+            template <typename _Offer>
+            void offer(_Offer&& item)
+            {
+                const std::uint64_t number = this->offered++;
+                if (this->kept.size() < this->capacity)
+                {
+                    this->kept.emplace_back(number, std::forward<_Offer>(item));
+                    if (this->kept.size() == this->capacity)
+                        this->drawSkip();
+                }
+                else if (this->skip > 0)
+                {
+                    this->skip--;
+                }
+                else
+                {
+                    std::pair<std::uint64_t, _Item>& replaced = this->kept[(size_t)random_below(*this->generator, this->capacity)];
+                    replaced.first = number;
+                    replaced.second = std::forward<_Offer>(item);
+                    this->drawSkip();
+                }
+            }
+
+            /// <summary>
+            /// Passes the items kept, in the order they were offered, to the given sink, emptying the reservoir.
+            /// </summary>
+            template <typename _Sink>
+            void drain(_Sink sink)
+            {
+                std::sort(this->kept.begin(), this->kept.end(), [](const auto& a, const auto& b) -> bool { return a.first < b.first; });
+                for (std::pair<std::uint64_t, _Item>& entry : this->kept)
+                    sink(std::move(entry.second));
+                this->kept.clear();
+            }
+
+        private:
+            std::vector<std::pair<std::uint64_t, _Item>> kept;
+            size_t capacity;
+            _Generator* generator;
+            std::uint64_t offered;
+            double threshold;
+            std::uint64_t skip;
+
+            void drawSkip()
+            {
+                // In effect every item draws a uniform key and the smallest keys are kept. The threshold is the largest key kept, and the
+                // number of items until one falls below it is geometric.
+                this->threshold *= std::exp(std::log(random_unit(*this->generator)) / (double)this->capacity);
+                const double gap = std::floor(std::log(random_unit(*this->generator)) / std::log1p(-this->threshold));
+                this->skip = gap < 18446744073709551616.0 ? (std::uint64_t)gap : std::numeric_limits<std::uint64_t>::max();
+            }
+        };
+
+        /// <summary>
+        /// Keeps a weighted random sample, without replacement, of a fixed number of the items offered to it, by Efraimidis and Spirakis'
+        /// A-ExpJ. In effect every item draws the key u^(1/weight) and the largest keys are kept; once full, the reservoir draws how much
+        /// weight to pass over before the next replacement, so most items cost a subtraction and no random numbers.
+        /// Items without a positive weight are never kept.
+        /// </summary>
+        /// <typeparam name="_Item">The type of the items kept.</typeparam>
+        /// <typeparam name="_Generator">A uniform random bit generator.</typeparam>
+        template <typename _Item, typename _Generator>
+        class weighted_reservoir
+        {
+        public:
+            weighted_reservoir(const size_t capacity, _Generator& generator) : capacity(capacity), generator(&generator), offered(0), jump(0.0) {}
+
+            /// <summary>
+            /// Offers the next item, which is only copied if it is kept.
+            /// </summary>
+            template <typename _Offer>
+            void offer(_Offer&& item, const double weight)
+            {
+                const std::uint64_t number = this->offered++;
+                if (!(weight > 0.0) || this->capacity == 0)
+                    return;
+
+                // Keys are kept as logarithms, which don't underflow for small weights
+                if (this->kept.size() < this->capacity)
+                {
+                    this->kept.push_back(entry{ std::log(random_unit(*this->generator)) / weight, number, std::forward<_Offer>(item) });
+                    std::push_heap(this->kept.begin(), this->kept.end(), weighted_reservoir::byKey);
+                    if (this->kept.size() == this->capacity)
+                        this->drawJump();
+                    return;
+                }
+                this->jump -= weight;
+                if (this->jump > 0.0)
+                    return;
+
+                // This item beats the least key kept, so its key is drawn from those above it
+                const double least = std::exp(this->kept.front().key * weight);
+                const double u = least + (1.0 - least) * random_unit(*this->generator);
+                std::pop_heap(this->kept.begin(), this->kept.end(), weighted_reservoir::byKey);
+                entry& replaced = this->kept.back();
+                replaced.key = std::log(u) / weight;
+                replaced.number = number;
+                replaced.item = std::forward<_Offer>(item);
+                std::push_heap(this->kept.begin(), this->kept.end(), weighted_reservoir::byKey);
+                this->drawJump();
+            }
+
+            /// <summary>
+            /// Passes the items kept, in the order they were offered, to the given sink, emptying the reservoir.
+            /// </summary>
+            template <typename _Sink>
+            void drain(_Sink sink)
+            {
+                std::sort(this->kept.begin(), this->kept.end(), [](const entry& a, const entry& b) -> bool { return a.number < b.number; });
+                for (entry& chosen : this->kept)
+                    sink(std::move(chosen.item));
+                this->kept.clear();
+            }
+
+        private:
+            struct entry
+            {
+                double key;
+                std::uint64_t number;
+                _Item item;
+            };
+
+            std::vector<entry> kept;
+            size_t capacity;
+            _Generator* generator;
+            std::uint64_t offered;
+            double jump;
+
+            // Least key on top
+            static bool byKey(const entry& a, const entry& b) { return a.key > b.key; }
+
+            void drawJump()
+            {
+                this->jump = std::log(random_unit(*this->generator)) / this->kept.front().key;
+            }
+        };
+
+        /// <summary>
+        /// Chooses the given number of positions, uniformly at random, from a run of the given length, in increasing order. The reservoir's
+        /// skips jump straight over the positions passed, so the time taken grows with the sample, and only logarithmically with the run.
+        /// </summary>
+        /// <param name="length">The length of the run.</param>
+        /// <param name="count">The number of positions to choose. All of them are chosen if the run is no longer.</param>
+        /// <param name="generator">The random number generator to use.</param>
+        template <typename _Generator>
+        std::vector<std::uint64_t> sample_positions(const std::uint64_t length, const size_t count, _Generator& generator)
+        {
+            reservoir<std::uint64_t, _Generator> chosen((size_t)std::min<std::uint64_t>(length, count), generator);
+            for (std::uint64_t position = 0; position < length;)
+            {
+                const std::uint64_t passed = std::min(chosen.skipping(), length - position);
+                chosen.pass(passed);
+                position += passed;
+                if (position < length)
+                    chosen.offer(position++);
+            }
+            std::vector<std::uint64_t> positions;
+            positions.reserve((size_t)std::min<std::uint64_t>(length, count));
+            chosen.drain([&positions](const std::uint64_t position) -> void { positions.push_back(position); });
+            return positions;
+        }
+
+        /// <summary>
+        /// Chooses a weighted random sample, without replacement, from a run of elements, passing the chosen ones to the given sink in order.
+        /// </summary>
+        /// <param name="first">The start of the run.</param>
+        /// <param name="length">The number of elements in the run.</param>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="weightOf">A callable object giving the weight of an element.</param>
+        /// <param name="generator">The random number generator to use.</param>
+        /// <param name="sink">A callable object taking each element chosen.</param>
+        template <typename _Iter, typename _Weigher, typename _Generator, typename _Sink>
+        void weighted_sample(const _Iter first, const size_t length, const size_t count, const _Weigher& weightOf, _Generator& generator, _Sink sink)
+        {
+            weighted_reservoir<size_t, _Generator> chosen(std::min(count, length), generator);
+            for (size_t i = 0; i < length; i++)
+                chosen.offer(i, (double)weightOf(first[i]));
+            chosen.drain([&first, &sink](const size_t i) -> void { sink(first[i]); });
+        }
+
+        /// <summary>
+        /// Whether the given type can give the weight of an element for weighted sampling: a callable object, other than a member pointer.
+        /// </summary>
+        template <typename _Weigher, typename _Type>
+        struct is_weigher : std::conjunction<
+            std::negation<std::is_member_pointer<_Weigher>>,
+            std::negation<is_uniform_random_bit_generator<_Weigher>>,
+            std::is_invocable_r<double, const _Weigher&, const _Type&>
+        > {};
+
+        template <typename _Weigher, typename _Type>
+        inline constexpr bool is_weigher_v = is_weigher<_Weigher, _Type>::value;
+    }
+
+    namespace detail
+    {
+        namespace simd
+        {
+            /// <summary>
+            /// Element types whose equality is a lane-wise comparison in a vector register.
+            /// </summary>
+            template <typename _Type>
+            inline constexpr bool is_searchable_v =
+                (std::is_integral_v<_Type> && !std::is_same_v<_Type, bool> && (sizeof(_Type) == 1 || sizeof(_Type) == 2 || sizeof(_Type) == 4 || sizeof(_Type) == 8))
+                || std::is_same_v<_Type, float>
+                || std::is_same_v<_Type, double>;
+
+            /// <summary>
+            /// Element types with vector min and max instructions at every supported level.
+            /// </summary>
+            template <typename _Type>
+            inline constexpr bool is_orderable_v =
+                (std::is_integral_v<_Type> && !std::is_same_v<_Type, bool> && sizeof(_Type) == 4)
+                || std::is_same_v<_Type, float>
+                || std::is_same_v<_Type, double>;
+
+            /// <summary>
+            /// Whether comparing elements of the given type with == against a match of the other type is the same as comparing them
+            /// against the match converted to the element type (provided the conversion is exact). True when both are integers of the same
+            /// signedness, or both floating point, since then the usual arithmetic conversions preserve values.
+            /// </summary>
+            template <typename _Type, typename _MatchType>
+            inline constexpr bool can_match_v =
+                is_searchable_v<_Type>
+                && std::is_arithmetic_v<_MatchType>
+                && !std::is_same_v<_MatchType, bool>
+                && (
+                    (std::is_integral_v<_Type> && std::is_integral_v<_MatchType> && std::is_signed_v<_Type> == std::is_signed_v<_MatchType>)
+                    || (std::is_floating_point_v<_Type> && std::is_floating_point_v<_MatchType>)
+                );
+
+            enum class level { scalar, sse2, avx2, avx512 };
+
+#if !defined(EASY_LIST_SIMD)
+            inline level detected_level() { return level::scalar; }
+#endif
+
+            inline unsigned popcount(uint64_t mask)
+            {
+                mask = mask - ((mask >> 1) & 0x5555555555555555ull);
+                mask = (mask & 0x3333333333333333ull) + ((mask >> 2) & 0x3333333333333333ull);
+                mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+                return (unsigned)((mask * 0x0101010101010101ull) >> 56);
+            }
+
+            inline unsigned count_trailing_zeros(uint64_t mask)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return (unsigned)__builtin_ctzll(mask);
+#else
+                unsigned n = 0;
+                while ((mask & 1) == 0)
+                {
+                    mask >>= 1;
+                    n++;
+                }
+                return n;
+#endif
+            }
+
+#if defined(EASY_LIST_SIMD)
+
+            /// <summary>
+            /// Finds the best instruction set supported by both the processor and the operating system. Detected once.
+            /// </summary>
+            inline level detected_level()
+            {
+                static const level detected = []() -> level {
+#if defined(_MSC_VER) && !defined(__clang__)
+                    int info[4];
+                    __cpuid(info, 0);
+                    const int maxLeaf = info[0];
+                    __cpuid(info, 1);
+                    const bool sse2 = (info[3] & (1 << 26)) != 0;
+                    const bool osxsave = (info[2] & (1 << 27)) != 0;
+                    const unsigned long long xcr0 = (osxsave ? _xgetbv(0) : 0);
+                    bool avx2 = false, avx512 = false;
+                    if (maxLeaf >= 7)
+                    {
+                        __cpuidex(info, 7, 0);
+                        avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+                        avx512 = (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0 && (xcr0 & 0xE6) == 0xE6;
+                    }
+#else
+                    __builtin_cpu_init();
+                    const bool sse2 = __builtin_cpu_supports("sse2");
+                    const bool avx2 = __builtin_cpu_supports("avx2");
+                    const bool avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+                    return avx512 ? level::avx512 : avx2 ? level::avx2 : sse2 ? level::sse2 : level::scalar;
+                }();
+                return detected;
+            }
+
+            /// <summary>
+            /// Combines the lanes of a vector accumulator with the elements left over after the last full vector.
+            /// </summary>
+            /// <returns>False if any leftover element is a NaN, in which case the caller falls back to the standard algorithm.</returns>
+            template <typename _Type, bool _Max>
+            bool extreme_tail(const _Type* lane, const size_t lanes, const _Type* tail, const size_t tailSize, _Type& result)
+            {
+                _Type best = lane[0];
+                for (size_t i = 1; i < lanes; i++)
+                {
+                    if (_Max ? best < lane[i] : lane[i] < best)
+                        best = lane[i];
+                }
+                for (size_t i = 0; i < tailSize; i++)
+                {
+                    if (!(tail[i] == tail[i]))
+                        return false;
+                    if (_Max ? best < tail[i] : tail[i] < best)
+                        best = tail[i];
+                }
+                result = best;
+                return true;
+            }
+
+            ////////////
+            /// SSE2 ///
+            ////////////
+
+            template <typename _Type>
+            EASY_LIST_TARGET("sse2") inline __m128i broadcast_sse2(const _Type value)
+            {
+                if constexpr (std::is_same_v<_Type, float>)
+                    return _mm_castps_si128(_mm_set1_ps(value));
+                else if constexpr (std::is_same_v<_Type, double>)
+                    return _mm_castpd_si128(_mm_set1_pd(value));
+                else if constexpr (sizeof(_Type) == 1)
+                    return _mm_set1_epi8((char)value);
+                else if constexpr (sizeof(_Type) == 2)
+                    return _mm_set1_epi16((short)value);
+                else if constexpr (sizeof(_Type) == 4)
+                    return _mm_set1_epi32((int)value);
+                else
+                    return _mm_set1_epi64x((long long)value);
+            }
+
+            // One bit per byte, so a matching element sets sizeof(_Type) consecutive bits
+            template <typename _Type>
+            EASY_LIST_TARGET("sse2") inline uint32_t equal_mask_sse2(const _Type* data, const __m128i needle)
+            {
+                if constexpr (std::is_same_v<_Type, float>)
+                    return (uint32_t)_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps((const float*)data), _mm_castsi128_ps(needle))));
+                else if constexpr (std::is_same_v<_Type, double>)
+                    return (uint32_t)_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd((const double*)data), _mm_castsi128_pd(needle))));
+                else
+                {
+                    const __m128i block = _mm_loadu_si128((const __m128i*)data);
+                    if constexpr (sizeof(_Type) == 1)
+                        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+                    else if constexpr (sizeof(_Type) == 2)
+                        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(block, needle));
+                    else if constexpr (sizeof(_Type) == 4)
+                        return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(block, needle));
+                    else
+                    {
+                        // SSE2 has no 64-bit compare: both 32-bit halves must match
+                        const __m128i halves = _mm_cmpeq_epi32(block, needle);
+                        return (uint32_t)_mm_movemask_epi8(_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))));
+                    }
+                }
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("sse2") size_t find_sse2(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 16 / sizeof(_Type);
+                const __m128i needle = broadcast_sse2(value);
+                size_t i = 0;
+                for (; i + lanes <= size; i += lanes)
+                {
+                    const uint32_t mask = equal_mask_sse2(data + i, needle);
+                    if (mask != 0)
+                        return i + count_trailing_zeros(mask) / sizeof(_Type);
+                }
+                for (; i < size; i++)
+                {
+                    if (data[i] == value)
+                        return i;
+                }
+                return size;
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("sse2") size_t count_sse2(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 16 / sizeof(_Type);
+                const __m128i needle = broadcast_sse2(value);
+                size_t bits = 0, n = 0, i = 0;
+                for (; i + lanes <= size; i += lanes)
+                    bits += popcount(equal_mask_sse2(data + i, needle));
+                for (; i < size; i++)
+                    n += (data[i] == value);
+                return n + bits / sizeof(_Type);
+            }
+
+            // Returns false, leaving the result unset, if the list is too short or contains a NaN
+            template <typename _Type, bool _Max>
+            EASY_LIST_TARGET("sse2") bool extreme_sse2(const _Type* data, const size_t size, _Type& result)
+            {
+                constexpr size_t lanes = 16 / sizeof(_Type);
+                if (size < lanes)
+                    return false;
+                alignas(16) _Type lane[lanes];
+                size_t i = lanes;
+                if constexpr (std::is_same_v<_Type, float>)
+                {
+                    __m128 acc = _mm_loadu_ps(data), nan = _mm_cmpunord_ps(acc, acc);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m128 block = _mm_loadu_ps(data + i);
+                        acc = (_Max ? _mm_max_ps(acc, block) : _mm_min_ps(acc, block));
+                        nan = _mm_or_ps(nan, _mm_cmpunord_ps(block, block));
+                    }
+                    if (_mm_movemask_ps(nan) != 0)
+                        return false;
+                    _mm_store_ps(lane, acc);
+                }
+                else if constexpr (std::is_same_v<_Type, double>)
+                {
+                    __m128d acc = _mm_loadu_pd(data), nan = _mm_cmpunord_pd(acc, acc);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m128d block = _mm_loadu_pd(data + i);
+                        acc = (_Max ? _mm_max_pd(acc, block) : _mm_min_pd(acc, block));
+                        nan = _mm_or_pd(nan, _mm_cmpunord_pd(block, block));
+                    }
+                    if (_mm_movemask_pd(nan) != 0)
+                        return false;
+                    _mm_store_pd(lane, acc);
+                }
+                else
+                {
+                    // SSE2 only has signed 32-bit comparisons, so unsigned values are compared with their top bits flipped
+                    const __m128i flip = _mm_set1_epi32(std::is_signed_v<_Type> ? 0 : (int)0x80000000u);
+                    __m128i acc = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data), flip);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m128i block = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data + i)), flip);
+                        const __m128i better = (_Max ? _mm_cmpgt_epi32(block, acc) : _mm_cmplt_epi32(block, acc));
+                        acc = _mm_or_si128(_mm_and_si128(better, block), _mm_andnot_si128(better, acc));
+                    }
+                    _mm_store_si128((__m128i*)lane, _mm_xor_si128(acc, flip));
+                }
+                return extreme_tail<_Type, _Max>(lane, lanes, data + i, size - i, result);
+            }
+
+            ////////////
+            /// AVX2 ///
+            ////////////
+
+            template <typename _Type>
+            EASY_LIST_TARGET("avx2") inline __m256i broadcast_avx2(const _Type value)
+            {
+                if constexpr (std::is_same_v<_Type, float>)
+                    return _mm256_castps_si256(_mm256_set1_ps(value));
+                else if constexpr (std::is_same_v<_Type, double>)
+                    return _mm256_castpd_si256(_mm256_set1_pd(value));
+                else if constexpr (sizeof(_Type) == 1)
+                    return _mm256_set1_epi8((char)value);
+                else if constexpr (sizeof(_Type) == 2)
+                    return _mm256_set1_epi16((short)value);
+                else if constexpr (sizeof(_Type) == 4)
+                    return _mm256_set1_epi32((int)value);
+                else
+                    return _mm256_set1_epi64x((long long)value);
+            }
+
+            // One bit per byte, so a matching element sets sizeof(_Type) consecutive bits
+            template <typename _Type>
+            EASY_LIST_TARGET("avx2") inline uint32_t equal_mask_avx2(const _Type* data, const __m256i needle)
+            {
+                if constexpr (std::is_same_v<_Type, float>)
+                    return (uint32_t)_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps((const float*)data), _mm256_castsi256_ps(needle), _CMP_EQ_OQ)));
+                else if constexpr (std::is_same_v<_Type, double>)
+                    return (uint32_t)_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd((const double*)data), _mm256_castsi256_pd(needle), _CMP_EQ_OQ)));
+                else
+                {
+                    const __m256i block = _mm256_loadu_si256((const __m256i*)data);
+                    if constexpr (sizeof(_Type) == 1)
+                        return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+                    else if constexpr (sizeof(_Type) == 2)
+                        return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(block, needle));
+                    else if constexpr (sizeof(_Type) == 4)
+                        return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi32(block, needle));
+                    else
+                        return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi64(block, needle));
+                }
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("avx2") size_t find_avx2(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 32 / sizeof(_Type);
+                const __m256i needle = broadcast_avx2(value);
+                size_t i = 0;
+                for (; i + lanes <= size; i += lanes)
+                {
+                    const uint32_t mask = equal_mask_avx2(data + i, needle);
+                    if (mask != 0)
+                        return i + count_trailing_zeros(mask) / sizeof(_Type);
+                }
+                for (; i < size; i++)
+                {
+                    if (data[i] == value)
+                        return i;
+                }
+                return size;
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("avx2") size_t count_avx2(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 32 / sizeof(_Type);
+                const __m256i needle = broadcast_avx2(value);
+                size_t bits = 0, n = 0, i = 0;
+                for (; i + lanes <= size; i += lanes)
+                    bits += popcount(equal_mask_avx2(data + i, needle));
+                for (; i < size; i++)
+                    n += (data[i] == value);
+                return n + bits / sizeof(_Type);
+            }
+
+            // Returns false, leaving the result unset, if the list is too short or contains a NaN
+            template <typename _Type, bool _Max>
+            EASY_LIST_TARGET("avx2") bool extreme_avx2(const _Type* data, const size_t size, _Type& result)
+            {
+                constexpr size_t lanes = 32 / sizeof(_Type);
+                if (size < lanes)
+                    return false;
+                alignas(32) _Type lane[lanes];
+                size_t i = lanes;
+                if constexpr (std::is_same_v<_Type, float>)
+                {
+                    __m256 acc = _mm256_loadu_ps(data), nan = _mm256_cmp_ps(acc, acc, _CMP_UNORD_Q);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m256 block = _mm256_loadu_ps(data + i);
+                        acc = (_Max ? _mm256_max_ps(acc, block) : _mm256_min_ps(acc, block));
+                        nan = _mm256_or_ps(nan, _mm256_cmp_ps(block, block, _CMP_UNORD_Q));
+                    }
+                    if (_mm256_movemask_ps(nan) != 0)
+                        return false;
+                    _mm256_store_ps(lane, acc);
+                }
+                else if constexpr (std::is_same_v<_Type, double>)
+                {
+                    __m256d acc = _mm256_loadu_pd(data), nan = _mm256_cmp_pd(acc, acc, _CMP_UNORD_Q);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m256d block = _mm256_loadu_pd(data + i);
+                        acc = (_Max ? _mm256_max_pd(acc, block) : _mm256_min_pd(acc, block));
+                        nan = _mm256_or_pd(nan, _mm256_cmp_pd(block, block, _CMP_UNORD_Q));
+                    }
+                    if (_mm256_movemask_pd(nan) != 0)
+                        return false;
+                    _mm256_store_pd(lane, acc);
+                }
+                else
+                {
+                    __m256i acc = _mm256_loadu_si256((const __m256i*)data);
+                    for (; i + lanes <= size; i += lanes)
+                    {
+                        const __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+                        if constexpr (std::is_signed_v<_Type>)
+                            acc = (_Max ? _mm256_max_epi32(acc, block) : _mm256_min_epi32(acc, block));
+                        else
+                            acc = (_Max ? _mm256_max_epu32(acc, block) : _mm256_min_epu32(acc, block));
+                    }
+                    _mm256_store_si256((__m256i*)lane, acc);
+                }
+                return extreme_tail<_Type, _Max>(lane, lanes, data + i, size - i, result);
+            }
+
+            ///////////////
+            /// AVX-512 ///
+            ///////////////
+
+            // One bit per element
+            template <typename _Type>
+            EASY_LIST_TARGET("avx512f,avx512bw") inline uint64_t equal_mask_avx512(const _Type* data, const _Type value)
+            {
+                if constexpr (std::is_same_v<_Type, float>)
+                    return _mm512_cmp_ps_mask(_mm512_loadu_ps(data), _mm512_set1_ps(value), _CMP_EQ_OQ);
+                else if constexpr (std::is_same_v<_Type, double>)
+                    return _mm512_cmp_pd_mask(_mm512_loadu_pd(data), _mm512_set1_pd(value), _CMP_EQ_OQ);
+                else
+                {
+                    const __m512i block = _mm512_loadu_si512((const void*)data);
+                    if constexpr (sizeof(_Type) == 1)
+                        return _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8((char)value));
+                    else if constexpr (sizeof(_Type) == 2)
+                        return _mm512_cmpeq_epi16_mask(block, _mm512_set1_epi16((short)value));
+                    else if constexpr (sizeof(_Type) == 4)
+                        return _mm512_cmpeq_epi32_mask(block, _mm512_set1_epi32((int)value));
+                    else
+                        return _mm512_cmpeq_epi64_mask(block, _mm512_set1_epi64((long long)value));
+                }
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("avx512f,avx512bw") size_t find_avx512(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 64 / sizeof(_Type);
+                size_t i = 0;
+                for (; i + lanes <= size; i += lanes)
+                {
+                    const uint64_t mask = equal_mask_avx512(data + i, value);
+                    if (mask != 0)
+                        return i + count_trailing_zeros(mask);
+                }
+                for (; i < size; i++)
+                {
+                    if (data[i] == value)
+                        return i;
+                }
+                return size;
+            }
+
+            template <typename _Type>
+            EASY_LIST_TARGET("avx512f,avx512bw") size_t count_avx512(const _Type* data, const size_t size, const _Type value)
+            {
+                constexpr size_t lanes = 64 / sizeof(_Type);
+                size_t n = 0, i = 0;
+                for (; i + lanes <= size; i += lanes)
+                    n += popcount(equal_mask_avx512(data + i, value));
+                for (; i < size; i++)
+                    n += (data[i] == value);
+                return n;
+            }
+
+            // Returns false, leaving the result unset, if the list is too short or contains a NaN. The last, partial block is loaded
+            // with its missing lanes filled from the accumulator, which leaves them as they were, and every step is masked with the
+            // accumulator passed through, so no lane is ever left undefined.
+            template <typename _Type, bool _Max>
+            EASY_LIST_TARGET("avx512f,avx512bw") bool extreme_avx512(const _Type* data, const size_t size, _Type& result)
+            {
+                constexpr size_t lanes = 64 / sizeof(_Type);
+                if (size < lanes)
+                    return false;
+                alignas(64) _Type lane[lanes];
+                if constexpr (std::is_same_v<_Type, float>)
+                {
+                    __m512 acc = _mm512_loadu_ps(data);
+                    __mmask16 nan = _mm512_cmp_ps_mask(acc, acc, _CMP_UNORD_Q);
+                    for (size_t i = lanes; i < size; i += lanes)
+                    {
+                        const __mmask16 live = (i + lanes <= size ? (__mmask16)0xFFFF : (__mmask16)((1u << (size - i)) - 1));
+                        const __m512 block = _mm512_mask_loadu_ps(acc, live, data + i);
+                        acc = (_Max ? _mm512_mask_max_ps(acc, live, acc, block) : _mm512_mask_min_ps(acc, live, acc, block));
+                        nan |= _mm512_mask_cmp_ps_mask(live, block, block, _CMP_UNORD_Q);
+                    }
+                    if (nan != 0)
+                        return false;
+                    _mm512_store_ps(lane, acc);
+                }
+                else if constexpr (std::is_same_v<_Type, double>)
+                {
+                    __m512d acc = _mm512_loadu_pd(data);
+                    __mmask8 nan = _mm512_cmp_pd_mask(acc, acc, _CMP_UNORD_Q);
+                    for (size_t i = lanes; i < size; i += lanes)
+                    {
+                        const __mmask8 live = (i + lanes <= size ? (__mmask8)0xFF : (__mmask8)((1u << (size - i)) - 1));
+                        const __m512d block = _mm512_mask_loadu_pd(acc, live, data + i);
+                        acc = (_Max ? _mm512_mask_max_pd(acc, live, acc, block) : _mm512_mask_min_pd(acc, live, acc, block));
+                        nan |= _mm512_mask_cmp_pd_mask(live, block, block, _CMP_UNORD_Q);
+                    }
+                    if (nan != 0)
+                        return false;
+                    _mm512_store_pd(lane, acc);
+                }
+                else
+                {
+                    __m512i acc = _mm512_loadu_si512((const void*)data);
+                    for (size_t i = lanes; i < size; i += lanes)
+                    {
+                        const __mmask16 live = (i + lanes <= size ? (__mmask16)0xFFFF : (__mmask16)((1u << (size - i)) - 1));
+                        const __m512i block = _mm512_mask_loadu_epi32(acc, live, (const void*)(data + i));
+                        if constexpr (std::is_signed_v<_Type>)
+                            acc = (_Max ? _mm512_mask_max_epi32(acc, live, acc, block) : _mm512_mask_min_epi32(acc, live, acc, block));
+                        else
+                            acc = (_Max ? _mm512_mask_max_epu32(acc, live, acc, block) : _mm512_mask_min_epu32(acc, live, acc, block));
+                    }
+                    _mm512_store_si512((void*)lane, acc);
+                }
+                return extreme_tail<_Type, _Max>(lane, lanes, data + size, 0, result);
+            }
+
+#endif // EASY_LIST_SIMD
+
+            ////////////////
+            /// DISPATCH ///
+            ////////////////
+
+            /// <summary>
+            /// Finds the index of the first element equal to the given value, using the best instruction set available.
+            /// </summary>
+            /// <returns>The index of the first match, or size if there is none.</returns>
+            template <typename _Type>
+            size_t find(const _Type* data, const size_t size, const _Type value)
+            {
+#if defined(EASY_LIST_SIMD)
+                switch (detected_level())
+                {
+                case level::avx512: return find_avx512(data, size, value);
+                case level::avx2: return find_avx2(data, size, value);
+                case level::sse2: return find_sse2(data, size, value);
+                default: break;
+                }
+#endif
+                return (size_t)(std::find(data, data + size, value) - data);
+            }
+
+            /// <summary>
+            /// Counts the elements equal to the given value, using the best instruction set available.
+            /// </summary>
+            template <typename _Type>
+            size_t count(const _Type* data, const size_t size, const _Type value)
+            {
+#if defined(EASY_LIST_SIMD)
+                switch (detected_level())
+                {
+                case level::avx512: return count_avx512(data, size, value);
+                case level::avx2: return count_avx2(data, size, value);
+                case level::sse2: return count_sse2(data, size, value);
+                default: break;
+                }
+#endif
+                return (size_t)std::count(data, data + size, value);
+            }
+
+            /// <summary>
+            /// Finds the first least (or, if _Max, the first greatest) element, using the best instruction set available.
+            /// Gives exactly the element std::min_element (std::max_element) would. The data must not be empty.
+            /// </summary>
+            template <typename _Type, bool _Max>
+            _Type extreme(const _Type* data, const size_t size)
+            {
+#if defined(EASY_LIST_SIMD)
+                _Type result;
+                bool found = false;
+                switch (detected_level())
+                {
+                case level::avx512: found = extreme_avx512<_Type, _Max>(data, size, result); break;
+                case level::avx2: found = extreme_avx2<_Type, _Max>(data, size, result); break;
+                case level::sse2: found = extreme_sse2<_Type, _Max>(data, size, result); break;
+                default: break;
+                }
+                if (found)
+                {
+                    // Zeroes of either sign are equal, so fetch the first one, as the standard algorithms would
+                    if constexpr (std::is_floating_point_v<_Type>)
+                    {
+                        if (result == 0)
+                            return data[simd::find(data, size, result)];
+                    }
+                    return result;
+                }
+#endif
+                return (_Max ? *std::max_element(data, data + size) : *std::min_element(data, data + size));
+            }
+        }
+    }
+
+    namespace detail
+    {
+        /// <summary>
+        /// Fewest elements worth radix sorting. Below this, the counting passes cost more than a comparison sort saves.
+        /// </summary>
+        inline constexpr size_t min_radix_sort = 256;
+
+        template <size_t _Size>
+        struct radix_bits_of {};
+
+        template <>
+        struct radix_bits_of<1> { using type = std::uint8_t; };
+
+        template <>
+        struct radix_bits_of<2> { using type = std::uint16_t; };
+
+        template <>
+        struct radix_bits_of<4> { using type = std::uint32_t; };
+
+        template <>
+        struct radix_bits_of<8> { using type = std::uint64_t; };
+
+        /// <summary>
+        /// The unsigned type a key of the given type is radix sorted as.
+        /// </summary>
+        template <typename _Key>
+        using radix_bits_t = typename radix_bits_of<sizeof(_Key)>::type;
+
+        /// <summary>
+        /// Whether keys of the given type can be radix sorted: integers, enums and IEEE floats of up to 64 bits. Not bool, since std::vector<bool> does not hold real bools.
+        /// </summary>
+        template <typename _Key>
+        inline constexpr bool is_radix_key_v =
+            sizeof(_Key) <= 8
+            && !std::is_same_v<_Key, bool>
+            && (std::is_integral_v<_Key>
+                || std::is_enum_v<_Key>
+                || (std::is_floating_point_v<_Key> && std::numeric_limits<_Key>::is_iec559 && sizeof(_Key) >= 4));
+
+        /// <summary>
+        /// Whether the given comparison orders keys of the given type by the < or > operator, which is the order a radix sort gives.
+        /// </summary>
+        template <typename _Compare, typename _Key>
+        inline constexpr bool is_ascending_v = std::is_same_v<_Compare, std::less<>> || std::is_same_v<_Compare, std::less<_Key>>;
+
+        template <typename _Compare, typename _Key>
+        inline constexpr bool is_descending_v = std::is_same_v<_Compare, std::greater<>> || std::is_same_v<_Compare, std::greater<_Key>>;
+
+        template <typename _Compare, typename _Key>
+        inline constexpr bool can_radix_sort_v = is_radix_key_v<_Key> && (is_ascending_v<_Compare, _Key> || is_descending_v<_Compare, _Key>);
+
+        /// <summary>
+        /// Maps a key to unsigned bits, such that comparing the bits as unsigned integers orders the keys as the < operator would (or the > operator, if descending).
+        /// </summary>
+        template <bool _Descending, typename _Key>
+        radix_bits_t<_Key> radix_bits(_Key key)
+        {
+            using _Bits = radix_bits_t<_Key>;
+            constexpr _Bits sign = _Bits(_Bits(1) << (sizeof(_Bits) * 8 - 1));
+            _Bits bits;
+            if constexpr (std::is_enum_v<_Key>)
+            {
+                return radix_bits<_Descending>(static_cast<std::underlying_type_t<_Key>>(key));
+            }
+            else if constexpr (std::is_floating_point_v<_Key>)
+            {
+                // Zeroes of either sign are equal, so must have the same bits
+                if (key == 0)
+                    key = 0;
+                std::memcpy(&bits, &key, sizeof(_Bits));
+                bits = ((bits & sign) ? _Bits(~bits) : _Bits(bits | sign));
+            }
+            else if constexpr (std::is_signed_v<_Key>)
+            {
+                bits = _Bits(_Bits(key) ^ sign);
+            }
+            else
+            {
+                bits = _Bits(key);
+            }
+            return (_Descending ? _Bits(~bits) : bits);
+        }
+
+        /// <summary>
+        /// Sorts the given items by least significant digit radix sort, a byte per pass. The sort is stable. Passes in which every item has the same byte are skipped.
+        /// </summary>
+        /// <param name="items">The items to sort. Must be a std::vector, or have its interface.</param>
+        /// <param name="bitsOf">A callable object giving the unsigned bits to sort each item by.</param>
+        template <typename _Vector, typename _BitsOf>
+        void radix_sort(_Vector& items, const _BitsOf& bitsOf)
+        {
+            using _Item = typename _Vector::value_type;
+            using _Bits = std::decay_t<std::invoke_result_t<const _BitsOf&, const _Item&>>;
+            constexpr size_t passes = sizeof(_Bits);
+            if (items.size() < 2)
+                return;
+
+            // Histogram every byte in one read of the items
+            size_t counts[passes][256] = {};
+            for (const auto& item : items)
+            {
+                const _Bits bits = bitsOf(item);
+                for (size_t pass = 0; pass < passes; pass++)
+                    counts[pass][(bits >> (8 * pass)) & 0xFF]++;
+            }
+
+            // Passes alternate between the items and the buffer. The buffers aren't swapped, as that isn't safe for every allocator
+            std::vector<_Item> buffer(items.size());
+            _Item* source = items.data();
+            _Item* target = buffer.data();
+            for (size_t pass = 0; pass < passes; pass++)
+            {
+                size_t* offsets = counts[pass];
+                if (offsets[(bitsOf(source[0]) >> (8 * pass)) & 0xFF] == items.size())
+                    continue;
+
+                size_t offset = 0;
+                for (size_t digit = 0; digit < 256; digit++)
+                {
+                    const size_t count = offsets[digit];
+                    offsets[digit] = offset;
+                    offset += count;
+                }
+                for (size_t i = 0; i < items.size(); i++)
+                    target[offsets[(bitsOf(source[i]) >> (8 * pass)) & 0xFF]++] = std::move(source[i]);
+                std::swap(source, target);
+            }
+            if (source != items.data())
+                std::move(source, source + items.size(), items.data());
+        }
+
+    }
+
+    namespace detail
+    {
+        /// <summary>
+        /// Whether elements of the given type are written out with std::to_chars. Characters and bools aren't, as they don't read as numbers.
+        /// </summary>
+        template <typename _Type>
+        inline constexpr bool is_to_chars_formattable_v =
+            std::is_arithmetic_v<_Type> && !std::is_same_v<_Type, bool> && !std::is_same_v<_Type, char>
+            && !std::is_same_v<_Type, wchar_t> && !std::is_same_v<_Type, char16_t> && !std::is_same_v<_Type, char32_t>;
+
+        /// <summary>
+        /// Gathers formatted text in a buffer on the stack, and hands it on to a sink in large pieces rather than a piece per element.
+        /// The sink is called with a pointer and a length, and returns false once it won't take any more.
+        /// </summary>
+        /// <typeparam name="_Char">The character type written.</typeparam>
+        /// <typeparam name="_Sink">A callable object, taking a const _Char* and a size_t and returning a bool.</typeparam>
+        template <typename _Char, typename _Sink>
+        class format_buffer
+        {
+        public:
+            explicit format_buffer(_Sink& sink) : sink(sink), length(0), open(true) {}
+
+            format_buffer(const format_buffer&) = delete;
+            format_buffer& operator=(const format_buffer&) = delete;
+
+            void append(const _Char* text, const size_t count)
+            {
+                if (count > capacity - this->length)
+                {
+                    this->flush();
+                    if (count > capacity)
+                    {
+                        this->open = this->open && this->sink(text, count);
+                        return;
+                    }
+                }
+                std::char_traits<_Char>::copy(this->chunk + this->length, text, count);
+                this->length += count;
+            }
+
+            void append(const std::basic_string_view<_Char> text) { this->append(text.data(), text.size()); }
+
+            /// <summary>
+            /// Appends ASCII text, widening it if need be.
+            /// </summary>
+            void appendAscii(const std::string_view text)
+            {
+                if constexpr (std::is_same_v<_Char, char>)
+                {
+                    this->append(text.data(), text.size());
+                }
+                else
+                {
+                    for (const char c : text)
+                    {
+                        if (this->length == capacity)
+                            this->flush();
+                        this->chunk[this->length++] = (_Char)c;
+                    }
+                }
+            }
+
+            template <typename _Number>
+            void appendNumber(const _Number value)
+            {
+                // Enough for the shortest round-trip form of any arithmetic type
+                constexpr size_t longest = 64;
+                if constexpr (std::is_same_v<_Char, char>)
+                {
+                    // Narrow digits go straight into the chunk, rather than through a buffer of their own
+                    if (capacity - this->length < longest)
+                        this->flush();
+                    const std::to_chars_result result = std::to_chars(this->chunk + this->length, this->chunk + capacity, value);
+                    this->length = (size_t)(result.ptr - this->chunk);
+                }
+                else
+                {
+                    char digits[longest];
+                    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+                    this->appendAscii(std::string_view(digits, (size_t)(result.ptr - digits)));
+                }
+            }
+
+            /// <summary>
+            /// Passes on whatever is buffered.
+            /// </summary>
+            /// <returns>Whether the sink took everything it was given.</returns>
+            bool flush()
+            {
+                if (this->length != 0)
+                {
+                    this->open = this->open && this->sink(this->chunk, this->length);
+                    this->length = 0;
+                }
+                return this->open;
+            }
+
+            bool good() const { return this->open; }
+
+        private:
+            static constexpr size_t capacity = 1024;
+
+            _Sink& sink;
+            _Char chunk[capacity];
+            size_t length;
+            bool open;
+        };
+    }
+
+    namespace detail
+    {
+        /// <summary>
+        /// The header at the start of a saved list. The elements follow, as raw bytes, at dataOffset, which keeps them aligned when the
+        /// file is mapped into memory. Everything is in the byte order of the machine that saved it.
+        /// </summary>
+        struct binary_header
+        {
+            char magic[4];
+            std::uint16_t version;
+            std::uint16_t dataOffset;
+            std::uint64_t typeSize;
+            std::uint64_t count;
+            std::uint64_t checksum;
+        };
+
+        inline constexpr char binary_magic[4] = { 'E', 'Z', 'L', 'S' };
+        inline constexpr std::uint16_t binary_version = 1;
+
+        /// <summary>
+        /// Where the elements of the given type start in a saved list.
+        /// </summary>
+        template <typename _Type>
+        constexpr size_t binary_data_offset()
+        {
+            return (sizeof(binary_header) + alignof(_Type) - 1) / alignof(_Type) * alignof(_Type);
+        }
+
+        /// <summary>
+        /// A quick 64-bit checksum of a run of bytes, for catching truncated or damaged files rather than tampering. Four lanes of
+        /// FNV-1a over 8-byte words run side by side, so it isn't held up waiting on each multiplication in turn.
+        /// </summary>
+        inline std::uint64_t checksum(const void* data, const size_t bytes)
+        {
+            constexpr std::uint64_t prime = 0x100000001b3ull;
+            std::uint64_t lanes[4] = { 0xcbf29ce484222325ull, 0x84222325cbf29ce4ull, 0x9ce484222325cbf2ull, 0x2325cbf29ce48422ull };
+            const unsigned char* bytePtr = static_cast<const unsigned char*>(data);
+
+            size_t i = 0;
+            for (; i + 32 <= bytes; i += 32)
+            {
+                for (size_t lane = 0; lane < 4; lane++)
+                {
+                    std::uint64_t word;
+                    std::memcpy(&word, bytePtr + i + 8 * lane, 8);
+                    lanes[lane] = (lanes[lane] ^ word) * prime;
+                }
+            }
+
+            std::uint64_t hash = (std::uint64_t)bytes;
+            for (const std::uint64_t lane : lanes)
+                hash = (hash ^ lane) * prime;
+            for (; i < bytes; i++)
+                hash = (hash ^ bytePtr[i]) * prime;
+            return hash;
+        }
+
+        /// <summary>
+        /// Checks that a header describes a list of the given element type, which this version can read.
+        /// </summary>
+        /// <exception cref="std::runtime_error">If it doesn't.</exception>
+        template <typename _Type>
+        void check_binary_header(const binary_header& header)
+        {
+            if (std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0)
+                throw std::runtime_error("easy_list: not a saved list");
+            if (header.version != binary_version)
+                throw std::runtime_error("easy_list: saved list is from an unsupported version");
+            if (header.typeSize != sizeof(_Type) || header.dataOffset != binary_data_offset<_Type>())
+                throw std::runtime_error("easy_list: saved list has elements of a different size");
+        }
+
+        // The most a stream which can't say how long it is gets read ahead of the data it turns out to hold
+        inline constexpr size_t load_chunk_bytes = (size_t)1 << 20;
+
+        /// <summary>
+        /// The number of bytes left to read in a stream, if it can seek, leaving it where it was.
+        /// </summary>
+        /// <returns>The bytes left, or the largest std::uint64_t if the stream can't seek.</returns>
+        inline std::uint64_t remaining_bytes(std::istream& stream)
+        {
+            const std::streampos here = stream.tellg();
+            if (here == std::streampos(-1))
+                return std::numeric_limits<std::uint64_t>::max();
+            stream.seekg(0, std::ios::end);
+            const std::streampos end = stream.tellg();
+            stream.clear();
+            stream.seekg(here);
+            if (end == std::streampos(-1) || end < here)
+                return std::numeric_limits<std::uint64_t>::max();
+            return (std::uint64_t)(end - here);
+        }
+    }
+
+    namespace detail
+    {
+        /// <summary>
+        /// Resolves the start and length of a slice, including negative values, into the range of indices it covers.
+        /// </summary>
+        /// <param name="listSize">The number of elements being sliced.</param>
+        /// <param name="start">The element to start at. A negative value counts back from the end of the list.</param>
+        /// <param name="length">The length of the slice. A negative value excludes that many elements from the end of the list.</param>
+        /// <param name="first">Set to the index of the first element in the slice.</param>
+        /// <param name="count">Set to the number of elements in the slice.</param>
+        inline void slice_bounds(const size_t listSize, long start, long length, size_t& first, size_t& count)
+        {
+            const long size = (long)listSize;
+            if (start < 0)
+                start = (size + start < 0 ? 0 : size + start);
+            if (length < 0)
+                length = size + length - start;
+
+            first = 0;
+            count = 0;
+            if (length <= 0 || start >= size)
+                return;
+            first = (size_t)start;
+            count = (size_t)(length > size - start ? size - start : length);
+        }
+    }
+
+    namespace detail
+    {
+        /// <summary>
+        /// Orders elements by a member, under a comparison of that member's values, as list::toSorted on a member does. It can also order
+        /// bare member values against each other and against elements, which is what lets a sorted_list ordered by it search on the member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the member's values.</typeparam>
+        /// <typeparam name="_Callable">The type of the member variable or method.</typeparam>
+        /// <typeparam name="..._Args">The types of the arguments passed to the member method, if applicable.</typeparam>
+        template <typename _Compare, typename _Callable, typename... _Args>
+        class member_order
+        {
+        public:
+            member_order(const _Compare& comparer, const _Callable& member, const _Args&... args) : comparer(comparer), member(member), args(args...) {}
+
+            template <typename _Lhs, typename _Rhs>
+            bool operator()(const _Lhs& lhs, const _Rhs& rhs) const
+            {
+                return this->comparer(this->key(lhs), this->key(rhs));
+            }
+
+        private:
+            _Compare comparer;
+            _Callable member;
+            std::tuple<_Args...> args;
+
+            template <typename _Value>
+            decltype(auto) key(const _Value& value) const
+            {
+                if constexpr (std::is_invocable_v<const _Callable&, const _Value&, const _Args&...>)
+                    return std::apply([this, &value](const _Args&... args) -> decltype(auto) { return std::invoke(this->member, value, args...); }, this->args);
+                else
+                    return (value);
+            }
+        };
+
+        template <typename _Compare>
+        struct is_member_order : std::false_type {};
+
+        template <typename _Compare, typename _Callable, typename... _Args>
+        struct is_member_order<member_order<_Compare, _Callable, _Args...>> : std::true_type {};
+    }
+
+    template <typename _Type, typename _Producer, typename _Alloc = std::allocator<_Type>>
+    class pipeline;
+
+    template <typename _Type, typename _Alloc>
+    class parallel;
+
+    template <typename _Type, typename _Compare = std::less<>, typename _Alloc = std::allocator<_Type>>
+    class sorted_list;
+
+    template <typename _Type, typename _Alloc>
+    class power_set_generator;
+
+    template <typename _Type, typename _Alloc>
+    class substring_generator;
+
+    template <typename _Type, typename _Alloc>
+    class slice_view;
+
+    template <typename _Type, typename _Alloc>
+    class reverse_view;
+
+    template <typename _Type, typename _Alloc, typename _Key, typename _Keyer>
+    class hash_index;
+
+    /// <summary>
+    /// An ordered list with better built-in functionality than ordinary vectors.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template<class _Type, class _Alloc = std::allocator<_Type>>
+    class list : public std::vector<_Type, _Alloc>
+    {
+    public:
+        using _Mybase = std::vector<_Type, _Alloc>;
+        template <typename _Traits> using _String = std::basic_string<_Type, _Traits, _Alloc>;
+        using value_type = _Type;
+        using allocator_type = typename _Mybase::allocator_type;
+        using size_type = typename _Mybase::size_type;
+
+        /// <summary>
+        /// A list of another element type, whose allocator is this list's allocator rebound to that type.
+        /// Results of other types are built with it, so that they come from the same arena or memory resource as this list.
+        /// </summary>
+        template <typename _Other>
+        using rebind_list = list<_Other, typename std::allocator_traits<_Alloc>::template rebind_alloc<_Other>>;
+
+        /// <summary>
+        /// Search operations return this if no match was found.
+        /// </summary>
+        /// <returns>An iterator object representing "no match found".</returns>
+        typename _Mybase::iterator npos() { return this->end(); }
+
+        /// <summary>
+        /// Const search operations return this if no match was found.
+        /// </summary>
+        /// <returns>An iterator object representing "no match found".</returns>
+        typename _Mybase::const_iterator npos() const { return this->end(); }
+
+        ////////////////////
+        /// CONSTRUCTORS ///
+        ////////////////////
+
+        list() : _Mybase() {}
+
+        explicit list(const _Alloc& _Al) : _Mybase(_Al) {}
+
+        list(const size_t _Count, const _Type& _Val, const _Alloc& _Al = _Alloc()) : _Mybase(_Count, _Val, _Al) {}
+
+        template <class _Iter, std::enable_if_t<detail::is_iterator_v<_Iter>, bool> = true>
+        list(_Iter _First, _Iter _Last, const _Alloc& _Al = _Alloc()) : _Mybase(_First, _Last, _Al) {}
+
+        list(std::initializer_list<_Type> _Ilist, const _Alloc& _Al = _Alloc()) : _Mybase(_Ilist, _Al) {}
+
+        list(const list& _Right) : _Mybase((const _Mybase&)_Right) {}
+        list(const list& _Right, const _Alloc& _Al) : _Mybase((const _Mybase&)_Right, _Al) {}
+        list(const _Mybase& _Right) : _Mybase(_Right) {}
+        list(const _Mybase& _Right, const _Alloc& _Al) : _Mybase(_Right, _Al) {}
+        template<typename _Traits> list(const _String<_Traits>& _Right, const _Alloc& _Al = _Alloc()) : _Mybase(_Right.begin(), _Right.end(), _Al) {}
+
+        list(list&& _Right) noexcept : _Mybase((_Mybase&&)_Right) {}
+        list(list&& _Right, const _Alloc& _Al) : _Mybase((_Mybase&&)_Right, _Al) {}
+        list(_Mybase&& _Right) noexcept : _Mybase(std::move(_Right)) {}
+        list(_Mybase&& _Right, const _Alloc& _Al) : _Mybase(std::move(_Right), _Al) {}
+        template<typename _Traits> list(_String<_Traits>&& _Right, const _Alloc& _Al = _Alloc()) : _Mybase(_Right.begin(), _Right.end(), _Al) {}
+
+        ~list() { }
+
+
+        //////////////////////////
+        /// OPERATOR OVERLOADS ///
+        //////////////////////////
+
+        list& operator=(const list& rhs) {
+            _Mybase::operator=((const _Mybase&)rhs);
+            return *this;
+        }
+        list& operator=(const _Mybase& rhs) {
+            _Mybase::operator=(rhs);
+            return *this;
+        }
+        template<typename _Traits>
+        list& operator=(const _String<_Traits>& rhs) {
+            return operator=(list(rhs));
+        }
+
+        list& operator=(list&& rhs) noexcept {
+            _Mybase::operator=((_Mybase&&)rhs);
+            return *this;
+        }
+        list& operator=(_Mybase&& rhs) noexcept {
+            _Mybase::operator=(std::move(rhs));
+            return *this;
+        }
+        template<typename _Traits>
+        list& operator=(_String<_Traits>&& rhs) {
+            return operator=(list(rhs));
+        }
+
+        /// <summary>
+        /// Concatenates two lists, or a list and a vector.
+        /// </summary>
+        /// <param name="rhs">The other vector to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        list operator+(const _Mybase& rhs) const& {
+            list result = list(*this, this->get_allocator());
+            for (_Type elem : rhs) result.push_back(elem);
+            return result;
+        }
+
+        /// <summary>
+        /// Concatenates a temporary list with a list or vector, appending to the temporary's storage.
+        /// </summary>
+        /// <param name="rhs">The other vector to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        list operator+(const _Mybase& rhs) && {
+            this->insert(this->end(), rhs.begin(), rhs.end());
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Concatenates this list with a single item.
+        /// </summary>
+        /// <param name="rhs">The item to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        list operator+(const _Type& rhs) const& {
+            auto result = list(*this, this->get_allocator());
+            result.push_back(rhs);
+            return result;
+        }
+
+        /// <summary>
+        /// Concatenates a temporary list with a single item, appending to the temporary's storage.
+        /// </summary>
+        /// <param name="rhs">The item to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        list operator+(const _Type& rhs) && {
+            this->push_back(rhs);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Appends (concatenates) a list or vector on the end of the current list.
+        /// </summary>
+        /// <param name="rhs">The vector to append.</param>
+        /// <returns>The list, after the append operation.</returns>
+        list& operator+=(const _Mybase& rhs) {
+            this->insert(this->end(), rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        /// <summary>
+        /// Appends (concatenates) a single item on the end of the current list.
+        /// </summary>
+        /// <param name="rhs">The item to append.</param>
+        /// <returns>This list, after the append operation.</returns>
+        list& operator+=(const _Type& rhs) {
+            this->push_back(rhs);
+            return *this;
+        }
+
+        /// <summary>
+        /// Exchanges the elements of this list with those of another.
+        /// </summary>
+        /// <param name="other">The list to swap with.</param>
+        void swap(list& other) noexcept
+        {
+            _Mybase::swap(other);
+        }
+
+    private:
+        std::string getTypeName() const
+        {
+            std::string str = "easy_list::list<";
+            str += typeid(_Type).name();
+            str += ">";
+            return str;
+        }
+
+        /// <summary>
+        /// Makes a list by copying the elements pointed to, in order.
+        /// </summary>
+        static list fromPointers(const std::vector<const _Type*>& elems, const _Alloc& _Al)
+        {
+            list result = list(_Al);
+            result.reserve(elems.size());
+            for (const _Type* elem : elems)
+                result.push_back(*elem);
+            return result;
+        }
+
+        /// <summary>
+        /// Writes the type name and elements of this list to a sink, through a buffer, leaving out any elements past the limit.
+        /// Arithmetic elements are written with std::to_chars, and anything else as template_helpers converts it.
+        /// </summary>
+        /// <returns>Whether the sink took all of the text.</returns>
+        template <typename _Char, typename _Sink>
+        bool formatWith(_Sink& sink, const std::basic_string_view<_Char> separator, const size_t limit) const
+        {
+            detail::format_buffer<_Char, _Sink> out(sink);
+            out.appendAscii(this->getTypeName());
+            out.appendAscii(": (");
+
+            const size_t shown = std::min(this->size(), limit);
+            for (size_t i = 0; i < shown && out.good(); i++)
+            {
+                if (i != 0)
+                    out.append(separator);
+
+                const _Type& elem = (*this)[i];
+                if constexpr (detail::is_to_chars_formattable_v<_Type>)
+                    out.appendNumber(elem);
+                else if constexpr (std::is_same_v<_Char, char>)
+                    out.append(template_helpers::convert_string(elem));
+                else
+                    out.append(template_helpers::convert_wstring(elem));
+            }
+
+            if (shown < this->size())
+            {
+                if (shown != 0)
+                    out.append(separator);
+                out.appendAscii("... (");
+                out.appendNumber(this->size() - shown);
+                out.appendAscii(" more)");
+            }
+            out.appendAscii(")");
+            return out.flush();
+        }
+
+        /// <summary>
+        /// A rough guess at the length of the formatted text, to reserve for it up front.
+        /// </summary>
+        size_t formattedLength(const size_t separatorLength, const size_t limit) const
+        {
+            constexpr size_t perElement = detail::is_to_chars_formattable_v<_Type> ? std::numeric_limits<_Type>::digits10 / 2 + 2 : 8;
+            return this->getTypeName().size() + 16 + std::min(this->size(), limit) * (perElement + separatorLength);
+        }
+
+    public:
+        template <typename = typename std::enable_if_t<template_helpers::can_convert_string<_Type>::value, bool>>
+        operator std::string() const
+        {
+            return this->format();
+        }
+
+        template <typename = typename std::enable_if_t<template_helpers::can_convert_wstring<_Type>::value, bool>>
+        operator std::wstring() const
+        {
+            std::wstring str;
+            str.reserve(this->formattedLength(2, SIZE_MAX));
+            auto sink = [&str](const wchar_t* text, const size_t count) -> bool { str.append(text, count); return true; };
+            this->formatWith<wchar_t>(sink, L", ", SIZE_MAX);
+            return str;
+        }
+
+        friend std::ostream& operator<<(std::ostream& stream, const list& list)
+        {
+            return list.formatTo(stream);
+        }
+
+        friend std::wostream& operator<<(std::wostream& stream, const list& list)
+        {
+            return list.formatTo(stream);
+        }
+
+        /// <summary>
+        /// Formats this list as text, in the same form as converting it to a string, but with the given separator and at most the given
+        /// number of elements. Any more are summarised by how many there are.
+        /// </summary>
+        /// <param name="separator">The text to put between elements.</param>
+        /// <param name="limit">The greatest number of elements to write out.</param>
+        /// <returns>The formatted list.</returns>
+        [[nodiscard]] std::string format(const std::string_view separator = ", ", const size_t limit = SIZE_MAX) const
+        {
+            std::string str;
+            str.reserve(this->formattedLength(separator.size(), limit));
+            auto sink = [&str](const char* text, const size_t count) -> bool { str.append(text, count); return true; };
+            this->formatWith<char>(sink, separator, limit);
+            return str;
+        }
+
+        /// <summary>
+        /// Writes this list straight to a stream, as text, without building a string first. The text is written in large pieces.
+        /// </summary>
+        /// <param name="stream">The stream to write to.</param>
+        /// <param name="separator">The text to put between elements.</param>
+        /// <param name="limit">The greatest number of elements to write out. Any more are summarised by how many there are.</param>
+        /// <returns>The stream.</returns>
+        std::ostream& formatTo(std::ostream& stream, const std::string_view separator = ", ", const size_t limit = SIZE_MAX) const
+        {
+            auto sink = [&stream](const char* text, const size_t count) -> bool { return (bool)stream.write(text, (std::streamsize)count); };
+            this->formatWith<char>(sink, separator, limit);
+            return stream;
+        }
+
+        /// <summary>
+        /// Writes this list straight to a wide stream, as text, without building a string first. The text is written in large pieces.
+        /// </summary>
+        /// <param name="stream">The stream to write to.</param>
+        /// <param name="separator">The text to put between elements.</param>
+        /// <param name="limit">The greatest number of elements to write out. Any more are summarised by how many there are.</param>
+        /// <returns>The stream.</returns>
+        std::wostream& formatTo(std::wostream& stream, const std::wstring_view separator = L", ", const size_t limit = SIZE_MAX) const
+        {
+            auto sink = [&stream](const wchar_t* text, const size_t count) -> bool { return (bool)stream.write(text, (std::streamsize)count); };
+            this->formatWith<wchar_t>(sink, separator, limit);
+            return stream;
+        }
+
+        /// <summary>
+        /// Writes this list as text into a caller-supplied buffer, in the manner of std::to_chars. The text is not null-terminated.
+        /// </summary>
+        /// <param name="first">The start of the buffer.</param>
+        /// <param name="last">The end of the buffer.</param>
+        /// <param name="separator">The text to put between elements.</param>
+        /// <param name="limit">The greatest number of elements to write out. Any more are summarised by how many there are.</param>
+        /// <returns>One past the last character written; or last, and std::errc::value_too_large, if the text didn't fit.</returns>
+        std::to_chars_result formatTo(char* first, char* const last, const std::string_view separator = ", ", const size_t limit = SIZE_MAX) const
+        {
+            auto sink = [&first, last](const char* text, const size_t count) -> bool {
+                if (count > (size_t)(last - first))
+                    return false;
+                std::memcpy(first, text, count);
+                first += count;
+                return true;
+            };
+            if (!this->formatWith<char>(sink, separator, limit))
+                return { last, std::errc::value_too_large };
+            return { first, std::errc() };
+        }
+
+
+        ////////////////////////
+        /// SAVING & LOADING ///
+        ////////////////////////
+
+        /// <summary>
+        /// Writes this list to a stream in a compact binary form: a header giving the element size, count and a checksum, followed by the
+        /// elements' bytes as they are in memory. Only for trivially copyable elements, and for reading back on a machine of the same byte order.
+        /// The stream should be opened in binary mode.
+        /// </summary>
+        /// <param name="stream">The stream to write to.</param>
+        /// <exception cref="std::runtime_error">If the stream couldn't be written to.</exception>
+        void save(std::ostream& stream) const
+        {
+            static_assert(std::is_trivially_copyable_v<_Type>, "easy_list::list::save needs trivially copyable elements");
+
+            constexpr size_t dataOffset = detail::binary_data_offset<_Type>();
+            const size_t bytes = this->size() * sizeof(_Type);
+
+            detail::binary_header header = {};
+            std::memcpy(header.magic, detail::binary_magic, sizeof(header.magic));
+            header.version = detail::binary_version;
+            header.dataOffset = (std::uint16_t)dataOffset;
+            header.typeSize = sizeof(_Type);
+            header.count = this->size();
+            header.checksum = detail::checksum(this->data(), bytes);
+
+            const char padding[dataOffset - sizeof(header) + 1] = {};
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(padding, dataOffset - sizeof(header));
+            stream.write(reinterpret_cast<const char*>(this->data()), (std::streamsize)bytes);
+            if (!stream)
+                throw std::runtime_error("easy_list: failed to save list");
+        }
+
+        /// <summary>
+        /// Writes this list to a file in a compact binary form, which can be read back with load, or mapped with mapped_list.
+        /// </summary>
+        /// <param name="path">The file to write. Anything already there is replaced.</param>
+        /// <exception cref="std::runtime_error">If the file couldn't be written.</exception>
+        void save(const std::string& path) const
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+                throw std::runtime_error("easy_list: can't open " + path);
+            this->save(file);
+        }
+
+        /// <summary>
+        /// Reads a list written by save from a stream, straight into the list's storage. The count in the header is checked against
+        /// what is left of a stream which can seek before anything is allocated; any other stream is read a chunk at a time, so
+        /// a corrupt count runs out of data long before it runs out of memory.
+        /// </summary>
+        /// <param name="stream">The stream to read from, opened in binary mode.</param>
+        /// <param name="_Al">The allocator to build the list with.</param>
+        /// <returns>The list read.</returns>
+        /// <exception cref="std::runtime_error">If the stream doesn't hold a list of this element type, is cut short, or fails the checksum.</exception>
+        [[nodiscard]] static list load(std::istream& stream, const _Alloc& _Al = _Alloc())
+        {
+            static_assert(std::is_trivially_copyable_v<_Type>, "easy_list::list::load needs trivially copyable elements");
+
+            detail::binary_header header;
+            if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+                throw std::runtime_error("easy_list: saved list is cut short");
+            detail::check_binary_header<_Type>(header);
+            if (header.count > std::numeric_limits<size_t>::max() / sizeof(_Type))
+                throw std::runtime_error("easy_list: saved list is too long");
+            stream.ignore(header.dataOffset - sizeof(header));
+            const size_t count = (size_t)header.count;
+            const std::uint64_t remaining = detail::remaining_bytes(stream);
+            if ((std::uint64_t)count * sizeof(_Type) > remaining)
+                throw std::runtime_error("easy_list: saved list is cut short");
+
+            list loaded = list(_Al);
+            if (remaining != std::numeric_limits<std::uint64_t>::max())
+                loaded.reserve(count);
+            const size_t chunk = std::max(detail::load_chunk_bytes / sizeof(_Type), (size_t)1);
+            while (loaded.size() < count)
+            {
+                const size_t from = loaded.size();
+                const size_t part = std::min(count - from, chunk);
+                loaded.resize(from + part);
+                if (!stream.read(reinterpret_cast<char*>(loaded.data() + from), (std::streamsize)(part * sizeof(_Type))))
+                    throw std::runtime_error("easy_list: saved list is cut short");
+            }
+            const size_t bytes = count * sizeof(_Type);
+            if (detail::checksum(loaded.data(), bytes) != header.checksum)
+                throw std::runtime_error("easy_list: saved list fails its checksum");
+            return loaded;
+        }
+
+        /// <summary>
+        /// Reads a list written by save from a file. To read one without copying it into memory, use mapped_list instead.
+        /// </summary>
+        /// <param name="path">The file to read.</param>
+        /// <param name="_Al">The allocator to build the list with.</param>
+        /// <returns>The list read.</returns>
+        /// <exception cref="std::runtime_error">If the file can't be read, doesn't hold a list of this element type, or fails the checksum.</exception>
+        [[nodiscard]] static list load(const std::string& path, const _Alloc& _Al = _Alloc())
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+                throw std::runtime_error("easy_list: can't open " + path);
+            return list::load(file, _Al);
+        }
+
+
+        ///////////////////
+        /// CONVERSIONS ///
+        ///////////////////
+
+        std::basic_string<_Type, std::char_traits<_Type>, _Alloc> toString() const
+        {
+            return std::basic_string<_Type, std::char_traits<_Type>, _Alloc>(this->begin(), this->end());
+        }
+
+        /// <summary>
+        /// Starts a lazy pipeline over this list. Selections, transformations and replacements chained onto the pipeline
+        /// are fused into a single pass, which only runs when the pipeline is materialised or aggregated.
+        /// The pipeline refers to this list, so must not outlive it.
+        /// </summary>
+        /// <returns>A pipeline yielding each element of this list in order.</returns>
+        [[nodiscard]] auto lazy() const
+        {
+            auto producer = [source = this](auto&& sink) -> void {
+                for (const _Type& elem : *source)
+                {
+                    if (!sink(elem))
+                        return;
+                }
+            };
+            return pipeline<_Type, decltype(producer), _Alloc>(producer, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Gives access to parallel versions of search, select, count, transform and replace on this list. Each splits the list into
+        /// contiguous chunks across the available cores, and merges the chunks' results so that the outcome is the same as the serial operation.
+        /// Predicates, transformers and members used with it must be safe to call from several threads at once.
+        /// The adaptor refers to this list, so must not outlive it.
+        /// </summary>
+        /// <returns>A parallel adaptor over this list.</returns>
+        [[nodiscard]] parallel<_Type, _Alloc> par() const
+        {
+            return parallel<_Type, _Alloc>(*this);
+        }
+
+        /// <summary>
+        /// Copies this list into a sorted list, ordered by the given comparison, which can then be searched by binary search.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>A sorted list of the elements of this list. Equal elements keep their order.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] sorted_list<_Type, _Compare, _Alloc> toSorted(const _Compare comparer) const&
+        {
+            return sorted_list<_Type, _Compare, _Alloc>(list(*this, this->get_allocator()), comparer);
+        }
+
+        /// <summary>
+        /// Moves the elements of this temporary list into a sorted list, ordered by the given comparison, which can then be searched by binary search.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>A sorted list of the elements of this list. Equal elements keep their order.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] sorted_list<_Type, _Compare, _Alloc> toSorted(const _Compare comparer) &&
+        {
+            return sorted_list<_Type, _Compare, _Alloc>(std::move(*this), comparer);
+        }
+
+        /// <summary>
+        /// Copies this list into a sorted list, ordered by the < operator.
+        /// </summary>
+        [[nodiscard]] sorted_list<_Type, std::less<>, _Alloc> toSorted() const&
+        {
+            return this->toSorted(std::less<>{});
+        }
+
+        /// <summary>
+        /// Moves the elements of this temporary list into a sorted list, ordered by the < operator.
+        /// </summary>
+        [[nodiscard]] sorted_list<_Type, std::less<>, _Alloc> toSorted() &&
+        {
+            return std::move(*this).toSorted(std::less<>{});
+        }
+
+        /// <summary>
+        /// Copies this list into a sorted list, ordered by the given comparison on a specified member. The sorted list can then also be
+        /// searched on that member by binary search.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sorted list of the elements of this list. Elements with equal members keep their order.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] sorted_list<_Type, detail::member_order<_Compare, _Callable, _Args...>, _Alloc> toSorted(const _Compare comparer, const _Callable member, const _Args&... args) const&
+        {
+            return list(*this, this->get_allocator()).toSorted(comparer, member, args...);
+        }
+
+        /// <summary>
+        /// Moves the elements of this temporary list into a sorted list, ordered by the given comparison on a specified member. The sorted
+        /// list can then also be searched on that member by binary search.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sorted list of the elements of this list. Elements with equal members keep their order.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] sorted_list<_Type, detail::member_order<_Compare, _Callable, _Args...>, _Alloc> toSorted(const _Compare comparer, const _Callable member, const _Args&... args) &&
+        {
+            using _Order = detail::member_order<_Compare, _Callable, _Args...>;
+            return sorted_list<_Type, _Order, _Alloc>(std::move(*this), _Order(comparer, member, args...));
+        }
+
+        /// <summary>
+        /// Copies this list into a sorted list, ordered by the < operator on a specified member. The sorted list can then also be searched
+        /// on that member by binary search.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sorted list of the elements of this list. Elements with equal members keep their order.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] sorted_list<_Type, detail::member_order<std::less<>, _Callable, _Args...>, _Alloc> toSorted(const _Callable member, const _Args&... args) const&
+        {
+            return this->toSorted(std::less<>{}, member, args...);
+        }
+
+        /// <summary>
+        /// Moves the elements of this temporary list into a sorted list, ordered by the < operator on a specified member. The sorted list
+        /// can then also be searched on that member by binary search.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sorted list of the elements of this list. Elements with equal members keep their order.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] sorted_list<_Type, detail::member_order<std::less<>, _Callable, _Args...>, _Alloc> toSorted(const _Callable member, const _Args&... args) &&
+        {
+            return std::move(*this).toSorted(std::less<>{}, member, args...);
+        }
+
+
+        /////////////////
+        /// SEARCHING ///
+        /////////////////
+
+        /// <summary>
+        /// Searches for an exact match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A const iterator to the first element found equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            > = true
+        >
+        [[nodiscard]] typename _Mybase::const_iterator search(const _MatchType& match) const
+        {
+            if constexpr (detail::simd::can_match_v<_Type, _MatchType>)
+            {
+                // If the match can't be represented as an element, nothing can equal it
+                const _Type needle = static_cast<_Type>(match);
+                if (!(static_cast<_MatchType>(needle) == match))
+                    return this->end();
+                return this->begin() + detail::simd::find(this->data(), this->size(), needle);
+            }
+            return std::find_if(
+                this->begin(),
+                this->end(),
+                [match](const _Type& other) -> bool { return other == match; }
+            );
+        }
+        
+        /// <summary>
+        /// Searches for an element satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A const iterator to the first element found to satisfy the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] typename _Mybase::const_iterator search(const _Predicate predicate) const
+        {
+            return std::find_if(this->begin(), this->end(), predicate);
+        }
+        
+        /// <summary>
+        /// Searches for an element with a member matching the given value.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to check against.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A const iterator to the first element found, such that the given member variable or method returned the match provided.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] typename _Mybase::const_iterator search(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return std::find_if(
+                this->begin(),
+                this->end(),
+                [match, member, args...](const _Type& other)
+                -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+
+        ////////////////
+        /// CONTAINS ///
+        ////////////////
+
+        /// <summary>
+        /// Checks whether the given element is contained in the list.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>True if a match was found, false otherwise.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _MatchType& match) const
+        {
+            return this->search(match) != this->npos();
+        }
+
+        /// <summary>
+        /// Checks whether any element in the list satisfies the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>True if any element satisfies the given predicate, false otherwise.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _Predicate predicate) const
+        {
+            return this->search(predicate) != this->npos();
+        }
+
+        /// <summary>
+        /// Checks whether any element in the list has the given member returning a match to the given value.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to check against.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>True if any element in the list returned the given value on the given member, false otherwise.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->search(match, member, args...) != this->npos();
+        }
+
+
+        ///////////////////////
+        /// UNIFY & DISJOIN ///
+        ///////////////////////
+
+        /// <summary>
+        /// Makes a new list from the union of the elements of this list with the list or vector provided.
+        /// </summary>
+        /// <param name="rhs">The list or vector to unify with this one.</param>
+        /// <returns>A list containing one instance of every element occurring at least once in either list, in the order in which they first occur in the right-hand side, followed by the order in which they first occur in this list.</returns>
+        [[nodiscard]] list unify(const _Mybase& rhs) const
+        {
+            std::vector<const _Type*> seq;
+            seq.reserve(this->size() + rhs.size());
+            for (const _Type& elem : *this)
+                seq.push_back(&elem);
+            for (const _Type& elem : rhs)
+                seq.push_back(&elem);
+            detail::unique_first_occurrences(seq);
+            return list::fromPointers(seq, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Makes a new list from the disjoint of the elements of this list with the list or vector provided.
+        /// </summary>
+        /// <param name="rhs">The list or vector to disjoin with this one.</param>
+        /// <returns>A list containing one instance of every element occurring at least once in both lists, in the order in which they first occur in the right-hand side.</returns>
+        [[nodiscard]] list disjoin(const _Mybase& rhs) const
+        {
+            std::vector<const _Type*> seq;
+            seq.reserve(rhs.size());
+            for (const _Type& elem : rhs)
+                seq.push_back(&elem);
+            detail::unique_first_occurrences(seq);
+            detail::keep_occurring_in(seq, this->begin(), this->end());
+            return list::fromPointers(seq, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Returns this list with all duplicates removed.
+        /// </summary>
+        [[nodiscard]] list removeDuplicates() const
+        {
+            std::vector<const _Type*> seq;
+            seq.reserve(this->size());
+            for (const _Type& elem : *this)
+                seq.push_back(&elem);
+            detail::unique_first_occurrences(seq);
+            return list::fromPointers(seq, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Checks whether the two lists share any elements.
+        /// </summary>
+        /// <param name="rhs">The other list or vector.</param>
+        /// <returns>True if any element was contained in both, false otherwise.</returns>
+        bool shares(const _Mybase& rhs) const
+        {
+            return this->disjoin(rhs).size() > 0;
+        }
+
+
+        /////////////
+        /// INDEX ///
+        /////////////
+
+        /// <summary>
+        /// Builds a hash index over a key computed from each element, which answers search, contains, count and select by that key in
+        /// constant time, where the list's own operations scan every element. Worth it when the same list is searched many times.
+        /// The index refers to this list, so must not outlive it, and answers for it as it is now until hash_index::refresh() or rebuild() is called.
+        /// </summary>
+        /// <typeparam name="_Keyer">A callable object, taking an element and returning its key, which std::hash can hash.</typeparam>
+        /// <param name="keyer">The function giving the key of each element.</param>
+        /// <returns>The index, built in a single pass over this list.</returns>
+        template <
+            typename _Keyer,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Keyer>>,
+                    std::is_invocable<const _Keyer&, const _Type&>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] auto index(const _Keyer keyer) const
+        {
+            using _Key = std::decay_t<std::invoke_result_t<const _Keyer&, const _Type&>>;
+            return hash_index<_Type, _Alloc, _Key, _Keyer>(*this, keyer);
+        }
+
+        /// <summary>
+        /// Builds a hash index over the given member of each element, which answers search, contains, count and select by that member in
+        /// constant time, where the list's own operations scan every element. Worth it when the same list is searched many times.
+        /// The index refers to this list, so must not outlive it, and answers for it as it is now until hash_index::refresh() or rebuild() is called.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method giving the key, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The index, built in a single pass over this list.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable<decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] auto index(const _Callable member, const _Args&... args) const
+        {
+            return this->index([member, args...](const _Type& elem) -> decltype(auto) { return std::invoke(member, elem, args...); });
+        }
+
+
+
+        ///////////////
+        /// SORTING ///
+        ///////////////
+
+        /// <summary>
+        /// Sorts the list with the given comparison. Lists of integers, enums or floats sorted by the < or > operator are radix sorted.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        list& sort(const _Compare comparer)
+        {
+            return this->sortElements<false>(comparer);
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison.
+        /// </summary>
+        /// <returns>This list, after having been sorted.</returns>
+        list& sort()
+        {
+            return this->sort(std::less<>{});
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison on a specified member. Members which are integers, enums or floats, sorted by the < or > operator, are radix sorted.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        list& sort(const _Compare comparer, const _Callable member, const _Args&... args)
+        {
+            return this->sortOn<false, _Result>(comparer, member, args...);
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison on a specified member.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Callable,
+            typename... _Args
+        >
+        list& sort(const _Callable member, const _Args&... args)
+        {
+            this->sort(std::less<>{}, member, args...);
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison, keeping equal elements in their original order.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        list& stableSort(const _Compare comparer)
+        {
+            return this->sortElements<true>(comparer);
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison, keeping equal elements in their original order.
+        /// </summary>
+        /// <returns>This list, after having been sorted.</returns>
+        list& stableSort()
+        {
+            return this->stableSort(std::less<>{});
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison on a specified member, keeping elements with equal members in their original order.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        list& stableSort(const _Compare comparer, const _Callable member, const _Args&... args)
+        {
+            return this->sortOn<true, _Result>(comparer, member, args...);
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison on a specified member, keeping elements with equal members in their original order.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Callable,
+            typename... _Args
+        >
+        list& stableSort(const _Callable member, const _Args&... args)
+        {
+            this->stableSort(std::less<>{}, member, args...);
+            return *this;
+        }
+
+    private:
+        /// <summary>
+        /// Sorts the elements themselves, by radix sort where the element type and comparison allow it.
+        /// </summary>
+        template <bool _Stable, typename _Compare>
+        list& sortElements(const _Compare& comparer)
+        {
+            if constexpr (detail::can_radix_sort_v<_Compare, _Type>)
+            {
+                if (this->size() >= detail::min_radix_sort)
+                {
+                    detail::radix_sort(static_cast<_Mybase&>(*this), [](const _Type& elem) -> auto {
+                        return detail::radix_bits<detail::is_descending_v<_Compare, _Type>>(elem);
+                    });
+                    return *this;
+                }
+            }
+
+            // Lists too short to radix sort are still sorted stably when they could have been, so the order doesn't depend on the length.
+            // Only floats need it: equal integers and enums are indistinguishable, but zeroes of either sign are not
+            auto static_comparer = template_helpers::cast_static_comparison<_Compare, _Type>(comparer);
+            if constexpr (_Stable || (detail::can_radix_sort_v<_Compare, _Type> && std::is_floating_point_v<_Type>))
+                std::stable_sort(this->begin(), this->end(), static_comparer);
+            else
+                std::sort(this->begin(), this->end(), static_comparer);
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list on a specified member, by radix sort where the member's type and comparison allow it.
+        /// </summary>
+        template <bool _Stable, typename _Result, typename _Compare, typename _Callable, typename... _Args>
+        list& sortOn(const _Compare& comparer, const _Callable& member, const _Args&... args)
+        {
+            using _Key = std::decay_t<_Result>;
+            if constexpr (detail::can_radix_sort_v<_Compare, _Key>)
+            {
+                if (this->size() >= detail::min_radix_sort)
+                    return this->sortByRadixKey<detail::is_descending_v<_Compare, _Key>>(member, args...);
+            }
+
+            // Lists too short to radix sort are still sorted stably when they could have been, so the order doesn't depend on the length
+            constexpr bool stable = _Stable || detail::can_radix_sort_v<_Compare, _Key>;
+            auto static_comparer = template_helpers::cast_static_comparison<_Compare, _Result>(comparer);
+
+            // Reading a member variable is cheap, but a member method may do real work, so call it once per element rather than twice per comparison
+            if constexpr (!std::is_member_object_pointer_v<_Callable>)
+                return this->sortByCachedKey<stable>(static_comparer, member, args...);
+
+            auto pred = [static_comparer, member, args...](const _Type& lhs, const _Type& rhs) -> auto {
+                const _Result resultLhs = std::invoke(member, lhs, args...);
+                const _Result resultRhs = std::invoke(member, rhs, args...);
+                return static_comparer(resultLhs, resultRhs);
+            };
+            if constexpr (stable)
+                std::stable_sort(this->begin(), this->end(), pred);
+            else
+                std::sort(this->begin(), this->end(), pred);
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list on a key computed once per element (decorate-sort-undecorate): the keys are sorted through an index permutation, which is then applied to the elements in place.
+        /// </summary>
+        /// <param name="comparer">The comparison on keys to sort by.</param>
+        /// <param name="member">A reference to the member variable or method giving each element's key.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <bool _Stable, typename _Compare, typename _Callable, typename... _Args>
+        list& sortByCachedKey(const _Compare& comparer, const _Callable& member, const _Args&... args)
+        {
+            using _Key = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>;
+            std::vector<_Key> keys;
+            keys.reserve(this->size());
+            for (const _Type& elem : *this)
+                keys.push_back(std::invoke(member, elem, args...));
+
+            std::vector<size_t> order(this->size());
+            std::iota(order.begin(), order.end(), (size_t)0);
+            auto byKey = [&keys, &comparer](size_t lhs, size_t rhs) -> bool { return comparer(keys[lhs], keys[rhs]); };
+            if constexpr (_Stable)
+                std::stable_sort(order.begin(), order.end(), byKey);
+            else
+                std::sort(order.begin(), order.end(), byKey);
+            return this->permute(order);
+        }
+
+        /// <summary>
+        /// Sorts the list on a member of integer, enum or float type by radix sort. Each element's key is read once, and sorted alongside its index;
+        /// the resulting permutation is then applied to the elements in place. The sort is stable.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method giving each element's key.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <bool _Descending, typename _Callable, typename... _Args>
+        list& sortByRadixKey(const _Callable& member, const _Args&... args)
+        {
+            using _Key = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>;
+            struct keyed
+            {
+                detail::radix_bits_t<_Key> bits;
+                size_t index;
+            };
+
+            std::vector<keyed> items;
+            items.reserve(this->size());
+            for (size_t i = 0; i < this->size(); i++)
+                items.push_back(keyed{ detail::radix_bits<_Descending>(_Key(std::invoke(member, (*this)[i], args...))), i });
+            detail::radix_sort(items, [](const keyed& item) -> auto { return item.bits; });
+
+            std::vector<size_t> order;
+            order.reserve(items.size());
+            for (const keyed& item : items)
+                order.push_back(item.index);
+            return this->permute(order);
+        }
+
+        /// <summary>
+        /// Rearranges the elements in place, by following the cycles of the given permutation.
+        /// </summary>
+        /// <param name="order">For each position, the index of the element that should end up there. Left as the identity permutation.</param>
+        /// <returns>This list, after the rearrangement.</returns>
+        list& permute(std::vector<size_t>& order)
+        {
+            for (size_t start = 0; start < order.size(); start++)
+            {
+                if (order[start] == start)
+                    continue;
+                _Type displaced = std::move((*this)[start]);
+                size_t pos = start;
+                while (order[pos] != start)
+                {
+                    size_t next = order[pos];
+                    (*this)[pos] = std::move((*this)[next]);
+                    order[pos] = pos;
+                    pos = next;
+                }
+                (*this)[pos] = std::move(displaced);
+                order[pos] = pos;
+            }
+            return *this;
+        }
+
+    public:
+
+
+        /////////////////
+        /// SELECTING ///
+        /////////////////
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A sub-list containing all elements of this list equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _MatchType& match) const&
+        {
+            list sublist = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (elem == match)
+                    sublist.push_back(elem);
+            }
+            return sublist;
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list equal to the provided match. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A sub-list containing all elements of this list equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _MatchType& match) &&
+        {
+            this->selectInPlace(match);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list containing all elements of this list satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _Predicate predicate) const&
+        {
+            list sublist = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (predicate(elem))
+                    sublist.push_back(elem);
+            }
+            return sublist;
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list equal to the provided match. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list containing all elements of this list satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _Predicate predicate) &&
+        {
+            this->selectInPlace(predicate);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list where the given member equals the provided match
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sub-list containing all elements of this list where the given member equals the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _Result& match, const _Callable member, const _Args&... args) const&
+        {
+            list sublist = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (std::invoke(member, elem, args...) == match)
+                    sublist.push_back(elem);
+            }
+            return sublist;
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list where the given member equals the provided match. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sub-list containing all elements of this list where the given member equals the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list select(const _Result& match, const _Callable member, const _Args&... args) &&
+        {
+            this->selectInPlace(match, member, args...);
+            return std::move(*this);
+        }
+
+        /// In place ///
+
+        /// <summary>
+        /// Removes from this list every element not equal to the provided match, without allocating.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the selection.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        list& selectInPlace(const _MatchType& match)
+        {
+            return this->selectInPlace([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Removes from this list every element failing the given predicate, without allocating.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the selection.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        list& selectInPlace(const _Predicate predicate)
+        {
+            this->erase(
+                std::remove_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return !predicate(other); }),
+                this->end()
+            );
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list every element where the given member doesn't equal the provided match, without allocating.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the selection.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        list& selectInPlace(const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->selectInPlace([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+
+        ////////////////
+        /// REMOVING ///
+        ////////////////
+
+        /// <summary>
+        /// Removes the element at the given index (if any element exists there) and returns the result.
+        /// </summary>
+        /// <param name="index">The index to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeAt(const long index) const&
+        {
+            const long actualIndex = (index < 0 ? (long)this->size() + index : index);
+            if (actualIndex < 0 || (size_t)actualIndex >= this->size())
+                return list(*this, this->get_allocator());
+
+            list result = list(this->get_allocator());
+            result.reserve(this->size() - 1);
+            result.insert(result.end(), this->begin(), this->begin() + actualIndex);
+            result.insert(result.end(), this->begin() + actualIndex + 1, this->end());
+            return result;
+        }
+
+        /// <summary>
+        /// Removes the element at the given index (if any element exists there) from this temporary list, and returns the result without copying.
+        /// </summary>
+        /// <param name="index">The index to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeAt(const long index) &&
+        {
+            long actualIndex = (index < 0 ? (long)this->size() + index : index);
+            if (actualIndex >= 0 && (size_t)actualIndex < this->size())
+                this->erase(this->begin() + actualIndex);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Removes the element at the given iterator (if any element exists there) and returns the result.
+        /// </summary>
+        /// <param name="index">The index to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeAt(const typename _Mybase::const_iterator iter) const&
+        {
+            return this->removeAt(std::distance(this->begin(), iter));
+        }
+
+        /// <summary>
+        /// Removes the element at the given iterator (if any element exists there) from this temporary list, and returns the result without copying.
+        /// </summary>
+        /// <param name="index">The index to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeAt(const typename _Mybase::const_iterator iter) &&
+        {
+            return std::move(*this).removeAt((long)std::distance(this->cbegin(), iter));
+        }
+
+        /// <summary>
+        /// Removes the elements at all the given indices and returns the result. Indices may be negative, repeated or in any order;
+        /// those with no element are ignored. Every kept element is copied once, so this is linear however many indices are given.
+        /// </summary>
+        /// <typeparam name="_Index">An integer type.</typeparam>
+        /// <param name="indices">The indices to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        template <typename _Index, std::enable_if_t<std::is_integral_v<_Index>, bool> = true>
+        [[nodiscard]] list removeAt(const std::vector<_Index>& indices) const&
+        {
+            const std::vector<bool> removed = this->removalMask(indices);
+            list result = list(this->get_allocator());
+            result.reserve(this->size());
+            for (size_t i = 0; i < this->size(); i++)
+            {
+                if (!removed[i])
+                    result.push_back((*this)[i]);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Removes the elements at all the given indices from this temporary list, and returns the result without copying.
+        /// </summary>
+        /// <typeparam name="_Index">An integer type.</typeparam>
+        /// <param name="indices">The indices to remove at.</param>
+        /// <returns>The result of the remove operation.</returns>
+        template <typename _Index, std::enable_if_t<std::is_integral_v<_Index>, bool> = true>
+        [[nodiscard]] list removeAt(const std::vector<_Index>& indices) &&
+        {
+            this->removeAtInPlace(indices);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Removes the elements from index first up to, but not including, index last, and returns the result.
+        /// </summary>
+        /// <param name="first">The first index to remove at. A negative value counts back from the end of the list.</param>
+        /// <param name="last">The index to stop removing at. A negative value counts back from the end of the list.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeRange(const long first, const long last) const&
+        {
+            size_t from, to;
+            this->rangeBounds(first, last, from, to);
+            list result = list(this->get_allocator());
+            result.reserve(this->size() - (to - from));
+            result.insert(result.end(), this->begin(), this->begin() + from);
+            result.insert(result.end(), this->begin() + to, this->end());
+            return result;
+        }
+
+        /// <summary>
+        /// Removes the elements from index first up to, but not including, index last from this temporary list, and returns the result without copying.
+        /// </summary>
+        /// <param name="first">The first index to remove at. A negative value counts back from the end of the list.</param>
+        /// <param name="last">The index to stop removing at. A negative value counts back from the end of the list.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeRange(const long first, const long last) &&
+        {
+            this->removeRangeInPlace(first, last);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Removes the elements in the given iterator range and returns the result.
+        /// </summary>
+        /// <param name="first">An iterator to the first element to remove.</param>
+        /// <param name="last">An iterator to the element after the last to remove.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeRange(const typename _Mybase::const_iterator first, const typename _Mybase::const_iterator last) const&
+        {
+            return this->removeRange((long)std::distance(this->cbegin(), first), (long)std::distance(this->cbegin(), last));
+        }
+
+        /// <summary>
+        /// Removes the elements in the given iterator range from this temporary list, and returns the result without copying.
+        /// </summary>
+        /// <param name="first">An iterator to the first element to remove.</param>
+        /// <param name="last">An iterator to the element after the last to remove.</param>
+        /// <returns>The result of the remove operation.</returns>
+        [[nodiscard]] list removeRange(const typename _Mybase::const_iterator first, const typename _Mybase::const_iterator last) &&
+        {
+            this->removeRangeInPlace(first, last);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list not equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to remove.</param>
+        /// <returns>A sub-list containing all elements of this list not equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list removeAll(const _MatchType& match) const
+        {
+            return this->select([match](_Type other) -> bool { return other != match; });
+        }
+
+        /// <summary>
+        /// Removes the first match and returns the result.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to remove.</param>
+        /// <returns>A sub-list of this with the first occurrence of the match removed.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+            [[nodiscard]] list removeFirst(const _MatchType& match) const
+        {
+            return this->removeAt(this->search(match));
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list failing the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list containing all elements of this list failing the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list removeAll(const _Predicate predicate) const
+        {
+            return this->select([predicate](_Type other) -> bool { return !predicate(other); });
+        }
+
+        /// <summary>
+        /// Removes the first element found satisfying the given predicate and returns the result.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list of this with the first element satisfying the predicate removed.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list removeFirst(const _Predicate predicate) const
+        {
+            return this->removeAt(this->search(predicate));
+        }
+
+        /// <summary>
+        /// Selects a sub-list containing all elements of this list where the given member doesn't equal the provided match
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to (not) match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sub-list containing all elements of this list where the given member doesn't equal the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list removeAll(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->select([match, member, args...](_Type other) -> bool { return std::invoke(member, other, args...) != match; });
+        }
+
+        /// <summary>
+        /// Removes the first element found whose specified members equals the specified match, and returns the result.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sub-list of this with the first element where the given member equals the given match removed.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list removeFirst(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->removeAt(this->search(match, member, args...));
+        }
+
+        /// In place ///
+
+        /// <summary>
+        /// Removes from this list the element at the given index, if any element exists there.
+        /// </summary>
+        /// <param name="index">The index to remove at. A negative value counts back from the end of the list.</param>
+        /// <returns>This list, after the removal.</returns>
+        list& removeAtInPlace(const long index)
+        {
+            const long actualIndex = (index < 0 ? (long)this->size() + index : index);
+            if (actualIndex >= 0 && (size_t)actualIndex < this->size())
+                this->erase(this->begin() + actualIndex);
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list the elements at all the given indices, in a single pass which moves each kept element at most once.
+        /// Indices may be negative, repeated or in any order; those with no element are ignored.
+        /// </summary>
+        /// <typeparam name="_Index">An integer type.</typeparam>
+        /// <param name="indices">The indices to remove at.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <typename _Index, std::enable_if_t<std::is_integral_v<_Index>, bool> = true>
+        list& removeAtInPlace(const std::vector<_Index>& indices)
+        {
+            const std::vector<bool> removed = this->removalMask(indices);
+            size_t kept = 0;
+            for (size_t i = 0; i < this->size(); i++)
+            {
+                if (removed[i])
+                    continue;
+                if (kept != i)
+                    (*this)[kept] = std::move((*this)[i]);
+                kept++;
+            }
+            this->erase(this->begin() + kept, this->end());
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list the elements from index first up to, but not including, index last.
+        /// </summary>
+        /// <param name="first">The first index to remove at. A negative value counts back from the end of the list.</param>
+        /// <param name="last">The index to stop removing at. A negative value counts back from the end of the list.</param>
+        /// <returns>This list, after the removal.</returns>
+        list& removeRangeInPlace(const long first, const long last)
+        {
+            size_t from, to;
+            this->rangeBounds(first, last, from, to);
+            this->erase(this->begin() + from, this->begin() + to);
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list the elements in the given iterator range.
+        /// </summary>
+        /// <param name="first">An iterator to the first element to remove.</param>
+        /// <param name="last">An iterator to the element after the last to remove.</param>
+        /// <returns>This list, after the removal.</returns>
+        list& removeRangeInPlace(const typename _Mybase::const_iterator first, const typename _Mybase::const_iterator last)
+        {
+            this->erase(first, last);
+            return *this;
+        }
+
+    private:
+        /// <summary>
+        /// Marks which elements are at the given indices, resolving negative indices and ignoring those out of range.
+        /// </summary>
+        template <typename _Index>
+        std::vector<bool> removalMask(const std::vector<_Index>& indices) const
+        {
+            std::vector<bool> removed(this->size(), false);
+            const long size = (long)this->size();
+            for (const _Index index : indices)
+            {
+                if constexpr (std::is_signed_v<_Index>)
+                {
+                    const long actualIndex = (index < 0 ? size + (long)index : (long)index);
+                    if (actualIndex >= 0 && actualIndex < size)
+                        removed[(size_t)actualIndex] = true;
+                }
+                else if ((size_t)index < this->size())
+                {
+                    removed[(size_t)index] = true;
+                }
+            }
+            return removed;
+        }
+
+        /// <summary>
+        /// Resolves a range of indices, including negative values, into bounds within the list. An empty or backwards range gives from == to.
+        /// </summary>
+        void rangeBounds(long first, long last, size_t& from, size_t& to) const
+        {
+            const long size = (long)this->size();
+            if (first < 0)
+                first += size;
+            if (last < 0)
+                last += size;
+            first = std::clamp(first, 0L, size);
+            last = std::clamp(last, first, size);
+            from = (size_t)first;
+            to = (size_t)last;
+        }
+
+    public:
+
+        /// <summary>
+        /// Removes from this list every element equal to the provided match, without allocating.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        list& removeAllInPlace(const _MatchType& match)
+        {
+            return this->removeAllInPlace([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Removes from this list every element satisfying the given predicate, without allocating.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        list& removeAllInPlace(const _Predicate predicate)
+        {
+            this->erase(
+                std::remove_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); }),
+                this->end()
+            );
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list every element where the given member equals the provided match, without allocating.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        list& removeAllInPlace(const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->removeAllInPlace([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+        /// <summary>
+        /// Removes from this list the first element equal to the provided match, if any.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        list& removeFirstInPlace(const _MatchType& match)
+        {
+            return this->removeFirstInPlace([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Removes from this list the first element satisfying the given predicate, if any.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        list& removeFirstInPlace(const _Predicate predicate)
+        {
+            auto iter = std::find_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); });
+            if (iter != this->end())
+                this->erase(iter);
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes from this list the first element where the given member equals the provided match, if any.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        list& removeFirstInPlace(const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->removeFirstInPlace([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+
+        ////////////////
+        /// COUNTING ///
+        ////////////////
+
+        /// <summary>
+        /// Finds the number of elements matching the specified value.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>The number of elements matching the specified value.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _MatchType& match) const
+        {
+            if constexpr (detail::simd::can_match_v<_Type, _MatchType>)
+            {
+                // If the match can't be represented as an element, nothing can equal it
+                const _Type needle = static_cast<_Type>(match);
+                if (!(static_cast<_MatchType>(needle) == match))
+                    return 0;
+                return detail::simd::count(this->data(), this->size(), needle);
+            }
+            return std::count_if(
+                this->begin(),
+                this->end(),
+                [&match](const _Type& other) -> bool { return other == match; }
+            );
+        }
+
+        /// <summary>
+        /// Counts the number of elements satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The number of elements satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_same<_Type, _Predicate>>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _Predicate predicate) const
+        {
+            return std::count_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); });
+        }
+
+        /// <summary>
+        /// Counts the number of elements matching the given value on the given member.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The number of elements matching the given value on the given member.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return std::count_if(
+                this->begin(),
+                this->end(),
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+
+        ///////////////////////
+        /// ANY, ALL & NONE ///
+        ///////////////////////
+
+        /// <summary>
+        /// Checks whether any element equals the provided match. Stops at the first match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>True if any element equals the match, false otherwise (including when the list is empty).</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool any(const _MatchType& match) const
+        {
+            return std::any_of(this->begin(), this->end(), [&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Checks whether any element satisfies the given predicate. Stops at the first element which does.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>True if any element satisfies the predicate, false otherwise (including when the list is empty).</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool any(const _Predicate predicate) const
+        {
+            return std::any_of(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); });
+        }
+
+        /// <summary>
+        /// Checks whether any element has the given member equal to the provided match. Stops at the first element which does.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>True if any element matches on the given member, false otherwise (including when the list is empty).</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] bool any(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return std::any_of(
+                this->begin(),
+                this->end(),
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+        /// <summary>
+        /// Checks whether every element equals the provided match. Stops at the first element which doesn't.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to compare against.</param>
+        /// <returns>True if every element equals the match (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool all(const _MatchType& match) const
+        {
+            return std::all_of(this->begin(), this->end(), [&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Checks whether every element satisfies the given predicate. Stops at the first element which doesn't.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>True if every element satisfies the predicate (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool all(const _Predicate predicate) const
+        {
+            return std::all_of(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); });
+        }
+
+        /// <summary>
+        /// Checks whether every element has the given member equal to the provided match. Stops at the first element which doesn't.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>True if every element matches on the given member (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] bool all(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return std::all_of(
+                this->begin(),
+                this->end(),
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+        /// <summary>
+        /// Checks whether no element equals the provided match. Stops at the first match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>True if no element equals the match (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool none(const _MatchType& match) const
+        {
+            return !this->any(match);
+        }
+
+        /// <summary>
+        /// Checks whether no element satisfies the given predicate. Stops at the first element which does.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>True if no element satisfies the predicate (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool none(const _Predicate predicate) const
+        {
+            return !this->any(predicate);
+        }
+
+        /// <summary>
+        /// Checks whether no element has the given member equal to the provided match. Stops at the first element which does.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>True if no element matches on the given member (including when the list is empty), false otherwise.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] bool none(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return !this->any(match, member, args...);
+        }
+
+
+        ////////////////////
+        /// TRANSFORMING ///
+        ////////////////////
+
+        /// <summary>
+        /// Makes a new list based on this list, converting each element into the given type.
+        /// </summary>
+        /// <typeparam name="_ConvertibleType">A type to which the elements of this list are convertible.</typeparam>
+        /// <returns>The result of the transformation.</returns>
+        template<class _ConvertibleType, std::enable_if_t<std::is_convertible_v<_Type, _ConvertibleType>, bool> = true>
+        [[nodiscard]] rebind_list<_ConvertibleType> transform()
+        {
+            auto result = rebind_list<_ConvertibleType>(this->get_allocator());
+            for (_Type elem : *this)
+                result.push_back(static_cast<_ConvertibleType>(elem));
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list based on this list, converting each element to a new element by use of the given transformer.
+        /// </summary>
+        /// <typeparam name="_Result">The elements of the result of the transformation.</typeparam>
+        /// <typeparam name="_Transformer">A callable object type, which takes elements of this list as arguments and returns elements of the result of the transformation.</typeparam>
+        /// <param name="transformer">The transformation to apply to each element in this current list.</param>
+        /// <param name="...args">The arguments to supply to the transformer, if applicable.</param>
+        /// <returns>The result of the transformation.</returns>
+        template <
+            typename _Result,
+            typename _Transformer,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Transformer>>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Transformer>()), _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] rebind_list<_Result> transform(const _Transformer transformer, const _Args&... args) const
+        {
+            rebind_list<_Result> result = rebind_list<_Result>(this->get_allocator());
+            for (_Type elem : *this)
+                result.push_back(transformer(elem, args...));
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list based on this list, converting each element into one of its members.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="member">A reference to the member variable or method to transform to, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the transformation.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                   std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] rebind_list<_Result> transform(const _Callable member, const _Args&... args) const
+        {
+            rebind_list<_Result> result = rebind_list<_Result>(this->get_allocator());
+            result.reserve(this->size());
+            for (const _Type& elem : *this)
+                result.push_back(std::invoke(member, elem, args...));
+            return result;
+        }
+
+
+        ///////////////
+        /// REPLACE ///
+        ///////////////
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each match found with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _MatchType& match) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (elem == match)
+                    result.push_back(replacement);
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each match found with the given replacement value. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _MatchType& match) &&
+        {
+            this->replaceInPlace(replacement, match);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each element satisfying the given predicate with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _Predicate predicate) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (predicate(elem))
+                    result.push_back(replacement);
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each element satisfying the given predicate with the given replacement value. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _Predicate predicate) &&
+        {
+            this->replaceInPlace(replacement, predicate);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each element matching the specified value on the specified member with the specified value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _Result& match, const _Callable member, const _Args&... args) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (std::invoke(member, elem, args...) == match)
+                    result.push_back(replacement);
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by replacing each element matching the specified value on the specified member with the specified value. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] list replace(_Replacer replacement, const _Result& match, const _Callable member, const _Args&... args) &&
+        {
+            this->replaceInPlace(replacement, match, member, args...);
+            return std::move(*this);
+        }
+
+        /// With transformer ///
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each match found.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _MatchType& match) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (elem == match)
+                    result.push_back(std::invoke(transformer, elem));
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each match found. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _MatchType& match) &&
+        {
+            this->replaceInPlace(transformer, match);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each element satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _Predicate predicate) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (predicate(elem))
+                    result.push_back(std::invoke(transformer, elem));
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each element satisfying the given predicate. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _Predicate predicate) &&
+        {
+            this->replaceInPlace(transformer, predicate);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each element matching the specified value on the specified member.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) const&
+        {
+            list result = list(this->get_allocator());
+            for (_Type elem : *this)
+            {
+                if (std::invoke(member, elem, args...) == match)
+                    result.push_back(std::invoke(transformer, elem));
+                else
+                    result.push_back(elem);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new list from this one by transforming each element matching the specified value on the specified member. Reuses the storage of this temporary list, moving rather than copying its elements.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] list replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) &&
+        {
+            this->replaceInPlace(transformer, match, member, args...);
+            return std::move(*this);
+        }
+
+        /// In place ///
+
+        /// <summary>
+        /// Replaces, in this list, each match found with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        list& replaceInPlace(const _Replacer& replacement, const _MatchType& match)
+        {
+            std::replace_if(this->begin(), this->end(), [&match](const _Type& other) -> bool { return other == match; }, static_cast<_Type>(replacement));
+            return *this;
+        }
+
+        /// <summary>
+        /// Replaces, in this list, each element satisfying the given predicate with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        list& replaceInPlace(const _Replacer& replacement, const _Predicate predicate)
+        {
+            std::replace_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); }, static_cast<_Type>(replacement));
+            return *this;
+        }
+
+        /// <summary>
+        /// Replaces, in this list, each element matching the specified value on the specified member with the specified value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        list& replaceInPlace(const _Replacer& replacement, const _Result& match, const _Callable member, const _Args&... args)
+        {
+            std::replace_if(
+                this->begin(),
+                this->end(),
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; },
+                static_cast<_Type>(replacement)
+            );
+            return *this;
+        }
+
+        /// <summary>
+        /// Transforms, in this list, each match found.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        list& replaceInPlace(const _Transformer transformer, const _MatchType& match)
+        {
+            return this->transformWhere(transformer, [&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Transforms, in this list, each element satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        list& replaceInPlace(const _Transformer transformer, const _Predicate predicate)
+        {
+            return this->transformWhere(transformer, predicate);
+        }
+
+        /// <summary>
+        /// Transforms, in this list, each element matching the specified value on the specified member.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        list& replaceInPlace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->transformWhere(
+                transformer,
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+    private:
+        template <typename _Transformer, typename _Predicate>
+        list& transformWhere(const _Transformer& transformer, const _Predicate& predicate)
+        {
+            for (_Type& elem : *this)
+            {
+                if (predicate(elem))
+                    elem = std::invoke(transformer, elem);
+            }
+            return *this;
+        }
+
+    public:
+
+
+        /////////////
+        /// SLICE ///
+        /////////////
+
+        /// <summary>
+        /// Makes a new list from a sub-string of elements of this one.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>The result of the slice.</returns>
+        list slice(const long start = LONG_MAX, const long length = LONG_MAX) const&
+        {
+            size_t first, count;
+            detail::slice_bounds(this->size(), start, length, first, count);
+            return list(this->begin() + first, this->begin() + first + count, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Makes a new list from a sub-string of elements of this temporary one, trimming it in place rather than copying.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>The result of the slice.</returns>
+        list slice(const long start = LONG_MAX, const long length = LONG_MAX) &&
+        {
+            size_t first, count;
+            detail::slice_bounds(this->size(), start, length, first, count);
+            this->erase(this->begin() + first + count, this->end());
+            this->erase(this->begin(), this->begin() + first);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a read-only view onto a sub-string of elements of this list, without copying them. The view must not outlive this list,
+        /// and is invalidated by anything which reallocates or shifts its elements.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>A view of the slice.</returns>
+        [[nodiscard]] slice_view<_Type, _Alloc> sliceView(const long start = LONG_MAX, const long length = LONG_MAX) const
+        {
+            size_t first, count;
+            detail::slice_bounds(this->size(), start, length, first, count);
+            return slice_view<_Type, _Alloc>(this->data() + first, count, this->get_allocator());
+        }
+
+        /// <summary>
+        /// Assigns to this list a sub-list formed of a sub-string of elements of the current list.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>This list after splicing.</returns>
+        list& splice(const size_t start, const long length = LONG_MAX)
+        {
+            if (length < 0)
+            {
+                long newLength = this->size() + length;
+                if (newLength < 0)
+                    return this->splice(start, 0);
+                return this->splice(start, newLength);
+            }
+            *this = this->slice(start, length);
+            return *this;
+        }
+
+        /// <summary>
+        /// Returns a list of all unique substrings of this list of the given length.
+        /// </summary>
+        rebind_list<list> substrings(const size_t length) const
+        {
+            if (length > this->size() || length == 0)
+                return rebind_list<list>({ list(this->get_allocator()) }, this->get_allocator());
+
+            if constexpr (detail::is_hashable_v<_Type>)
+            {
+                // Only the distinct windows are copied out, in order of first occurrence
+                rebind_list<list> result = rebind_list<list>(this->get_allocator());
+                for (size_t start : this->distinctWindows(length))
+                    result.push_back(list(this->begin() + start, this->begin() + start + length, this->get_allocator()));
+                return result;
+            }
+
+            rebind_list<list> result = rebind_list<list>(this->get_allocator());
+            for (size_t i = 0; i <= this->size() - length; i++)
+                result.push_back(this->slice(i, (long)length));
+
+            // Remove duplicates before returning
+            return result.removeDuplicates();
+        }
+
+    private:
+        /// <summary>
+        /// Finds the start of the first occurrence of each distinct window of the given length, in near-linear time. A polynomial hash of
+        /// every window is computed by rolling it along the list (Rabin-Karp), then windows are deduplicated by hash, comparing the elements
+        /// themselves only when hashes are equal, so collisions can't merge different windows.
+        /// </summary>
+        /// <param name="length">The length of the windows. Must be between 1 and the size of this list.</param>
+        /// <returns>The start of each distinct window, in increasing order.</returns>
+        std::vector<size_t> distinctWindows(const size_t length) const
+        {
+            const std::uint64_t base = 0x100000001b3ULL;
+            const size_t windows = this->size() - length + 1;
+
+            // Scramble each element's hash, so that types whose hash is the identity still spread over all the bits
+            std::vector<std::uint64_t> elementHashes;
+            elementHashes.reserve(this->size());
+            for (const _Type& elem : *this)
+            {
+                std::uint64_t hash = (std::uint64_t)std::hash<_Type>{}(elem) + 0x9e3779b97f4a7c15ULL;
+                hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+                elementHashes.push_back(hash ^ (hash >> 31));
+            }
+
+            // Arithmetic is modulo 2^64; leading is base^(length - 1), the weight of the element leaving the window
+            std::uint64_t leading = 1;
+            for (size_t i = 1; i < length; i++)
+                leading *= base;
+            std::vector<std::uint64_t> windowHashes(windows);
+            std::uint64_t hash = 0;
+            for (size_t i = 0; i < length; i++)
+                hash = hash * base + elementHashes[i];
+            windowHashes[0] = hash;
+            for (size_t start = 1; start < windows; start++)
+            {
+                hash = (hash - elementHashes[start - 1] * leading) * base + elementHashes[start + length - 1];
+                windowHashes[start] = hash;
+            }
+
+            auto hasher = [&windowHashes](size_t start) -> size_t { return (size_t)windowHashes[start]; };
+            auto equal = [this, &windowHashes, length](size_t lhs, size_t rhs) -> bool {
+                return windowHashes[lhs] == windowHashes[rhs]
+                    && std::equal(this->begin() + lhs, this->begin() + lhs + length, this->begin() + rhs);
+            };
+            std::unordered_set<size_t, decltype(hasher), decltype(equal)> seen(windows, hasher, equal);
+            std::vector<size_t> starts;
+            for (size_t start = 0; start < windows; start++)
+            {
+                if (seen.insert(start).second)
+                    starts.push_back(start);
+            }
+            return starts;
+        }
+
+    public:
+
+        /// <summary>
+        /// Returns a list of all unique substrings of this list.
+        /// </summary>
+        rebind_list<list> substrings() const
+        {
+            rebind_list<list> result = rebind_list<list>(this->get_allocator());
+            for (size_t length = 0; length <= this->size(); length++)
+                result += substrings(length);
+            return result;
+        }
+
+        /// <summary>
+        /// Generates every substring of this list of the given length one at a time, in order of their start. Substrings with equal elements are each generated.
+        /// The generator refers to this list, so must not outlive it.
+        /// </summary>
+        /// <returns>A generator of the substrings, which can be iterated, indexed, or split into ranges.</returns>
+        [[nodiscard]] substring_generator<_Type, _Alloc> lazySubstrings(const size_t length) const
+        {
+            return substring_generator<_Type, _Alloc>(*this, length, length);
+        }
+
+        /// <summary>
+        /// Generates every substring of this list one at a time, shortest first, then in order of their start. Substrings with equal elements are each generated.
+        /// The generator refers to this list, so must not outlive it.
+        /// </summary>
+        /// <returns>A generator of the substrings, which can be iterated, indexed, or split into ranges.</returns>
+        [[nodiscard]] substring_generator<_Type, _Alloc> lazySubstrings() const
+        {
+            return substring_generator<_Type, _Alloc>(*this, 0, this->size());
+        }
+
+        ///////////////
+        /// SHUFFLE ///
+        ///////////////
+
+        /// <summary>
+        /// Randomises the order of elements in this list. Every call gives a different order.
+        /// </summary>
+        /// <returns>This list, after the shuffle.</returns>
+        list& shuffle()
+        {
+            xoshiro256 generator;
+            return this->shuffle(generator);
+        }
+
+        /// <summary>
+        /// Randomises the order of elements in this list reproducibly: the same seed always gives the same order for the same list.
+        /// </summary>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        list& shuffle(const std::uint64_t seed)
+        {
+            xoshiro256 generator(seed);
+            return this->shuffle(generator);
+        }
+
+        /// <summary>
+        /// Randomises the order of elements in this list, drawing on the given random number generator.
+        /// </summary>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        template <typename _Generator, std::enable_if_t<detail::is_uniform_random_bit_generator_v<_Generator>, bool> = true>
+        list& shuffle(_Generator&& generator)
+        {
+            detail::fisher_yates(this->begin(), this->size(), this->size(), generator);
+            return *this;
+        }
+
+        /// <summary>
+        /// Randomises the order of elements in this list on several threads, for very large lists. Elements are scattered into buckets at
+        /// random, and the buckets shuffled at once, which gives every order with equal probability, as a serial shuffle does.
+        /// Lists too small to gain from it, or whose elements can't be default-constructed, are shuffled serially. The buckets are
+        /// taken from the list's own allocator, in one allocation on the calling thread.
+        /// </summary>
+        /// <returns>This list, after the shuffle.</returns>
+        list& shuffleParallel()
+        {
+            return this->shuffleParallel(detail::fresh_seed());
+        }
+
+        /// <summary>
+        /// Randomises the order of elements in this list on several threads, reproducibly. The order depends only on the seed and the
+        /// list, not on the number of threads, though it differs from the order shuffle(seed) gives.
+        /// </summary>
+        /// <param name="seed">The seed for the random number generators.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        list& shuffleParallel(const std::uint64_t seed)
+        {
+            if constexpr (!std::is_default_constructible_v<_Type> || !std::is_move_assignable_v<_Type>)
+            {
+                return this->shuffle(seed);
+            }
+            else
+            {
+                const size_t size = this->size();
+                if (size < detail::min_parallel_shuffle)
+                    return this->shuffle(seed);
+
+                // A power of two buckets, so that each element's bucket is just the top bits of a random number. The buckets, and the
+                // chunks each generator covers, depend only on the size, which is what makes the order independent of the thread count.
+                int bucketBits = 0;
+                while ((size_t)2 << bucketBits <= std::min(detail::max_shuffle_buckets, size / detail::min_parallel_chunk))
+                    bucketBits++;
+                const size_t buckets = (size_t)1 << bucketBits;
+                const auto bucketOf = [bucketBits](xoshiro256& generator) -> size_t {
+                    return bucketBits == 0 ? 0 : (size_t)(generator() >> (64 - bucketBits));
+                };
+
+                // One generator for each chunk to scatter, then one for each bucket to shuffle, on sequences which don't overlap
+                std::vector<xoshiro256> generators(2 * buckets, xoshiro256(seed));
+                for (size_t i = 1; i < generators.size(); i++)
+                {
+                    generators[i] = generators[i - 1];
+                    generators[i].jump();
+                }
+
+                // Count how many elements each chunk sends to each bucket, which places each chunk's share of each bucket
+                std::vector<size_t> offsets(buckets * buckets);
+                detail::parallel_chunks(size, buckets, [&generators, &offsets, &bucketOf, buckets](size_t chunk, size_t first, size_t last) -> void {
+                    xoshiro256 generator = generators[chunk];
+                    for (size_t i = first; i < last; i++)
+                        offsets[chunk * buckets + bucketOf(generator)]++;
+                });
+                std::vector<size_t> bucketStarts(buckets + 1);
+                size_t total = 0;
+                for (size_t bucket = 0; bucket < buckets; bucket++)
+                {
+                    bucketStarts[bucket] = total;
+                    for (size_t chunk = 0; chunk < buckets; chunk++)
+                    {
+                        const size_t count = offsets[chunk * buckets + bucket];
+                        offsets[chunk * buckets + bucket] = total;
+                        total += count;
+                    }
+                }
+                bucketStarts[buckets] = total;
+
+                // Scatter, drawing the same buckets again from fresh copies of the same generators
+                std::vector<_Type, _Alloc> scattered(size, this->get_allocator());
+                detail::parallel_chunks(size, buckets, [this, &generators, &offsets, &scattered, &bucketOf, buckets](size_t chunk, size_t first, size_t last) -> void {
+                    xoshiro256 generator = generators[chunk];
+                    size_t* chunkOffsets = offsets.data() + chunk * buckets;
+                    for (size_t i = first; i < last; i++)
+                        scattered[chunkOffsets[bucketOf(generator)]++] = std::move((*this)[i]);
+                });
+
+                // Shuffle each bucket, and move it back into place
+                detail::parallel_chunks(buckets, buckets, [this, &generators, &bucketStarts, &scattered, buckets](size_t, size_t from, size_t to) -> void {
+                    for (size_t bucket = from; bucket < to; bucket++)
+                    {
+                        const size_t start = bucketStarts[bucket];
+                        const size_t count = bucketStarts[bucket + 1] - start;
+                        detail::fisher_yates(scattered.begin() + start, count, count, generators[buckets + bucket]);
+                        std::move(scattered.begin() + start, scattered.begin() + start + count, this->begin() + start);
+                    }
+                });
+                return *this;
+            }
+        }
+
+        /// <summary>
+        /// Randomises only the first few positions of this list: each is filled with an element chosen at random from those not yet placed,
+        /// as a full shuffle would, which takes time in proportion to the positions filled, not the length of the list. The elements
+        /// after them are left in no particular order.
+        /// </summary>
+        /// <param name="count">The number of positions to fill, from the front.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        list& partialShuffle(const size_t count)
+        {
+            xoshiro256 generator;
+            return this->partialShuffle(count, generator);
+        }
+
+        /// <summary>
+        /// Randomises only the first few positions of this list, reproducibly. The positions are filled as shuffle(seed) would fill them.
+        /// </summary>
+        /// <param name="count">The number of positions to fill, from the front.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        list& partialShuffle(const size_t count, const std::uint64_t seed)
+        {
+            xoshiro256 generator(seed);
+            return this->partialShuffle(count, generator);
+        }
+
+        /// <summary>
+        /// Randomises only the first few positions of this list, drawing on the given random number generator.
+        /// </summary>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of positions to fill, from the front.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>This list, after the shuffle.</returns>
+        template <typename _Generator, std::enable_if_t<detail::is_uniform_random_bit_generator_v<_Generator>, bool> = true>
+        list& partialShuffle(const size_t count, _Generator&& generator)
+        {
+            detail::fisher_yates(this->begin(), this->size(), count, generator);
+            return *this;
+        }
+
+
+        //////////////
+        /// SAMPLE ///
+        //////////////
+
+        /// <summary>
+        /// Copies a random sample of elements into a new list, each element as likely to be chosen as any other. Elements are chosen by
+        /// skipping over the list, so sampling a few from a long list is quick, and this list is left as it is. Every call gives a different sample.
+        /// </summary>
+        /// <param name="count">The number of elements to choose. Every element is chosen if the list is no longer.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        [[nodiscard]] list sample(const size_t count) const
+        {
+            xoshiro256 generator;
+            return this->sample(count, generator);
+        }
+
+        /// <summary>
+        /// Copies a random sample of elements into a new list reproducibly: the same seed always gives the same sample of the same list.
+        /// </summary>
+        /// <param name="count">The number of elements to choose. Every element is chosen if the list is no longer.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        [[nodiscard]] list sample(const size_t count, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            return this->sample(count, generator);
+        }
+
+        /// <summary>
+        /// Copies a random sample of elements into a new list, drawing on the given random number generator.
+        /// </summary>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of elements to choose. Every element is chosen if the list is no longer.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <typename _Generator, std::enable_if_t<detail::is_uniform_random_bit_generator_v<_Generator>, bool> = true>
+        [[nodiscard]] list sample(const size_t count, _Generator&& generator) const
+        {
+            const std::vector<std::uint64_t> positions = detail::sample_positions(this->size(), count, generator);
+            list result = list(this->get_allocator());
+            result.reserve(positions.size());
+            for (const std::uint64_t position : positions)
+                result.push_back((*this)[(size_t)position]);
+            return result;
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement: each element is chosen with a likelihood in
+        /// proportion to its weight among those not yet chosen. Elements without a positive weight are never chosen. Takes a single pass.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+        [[nodiscard]] list sample(const size_t count, const _Weigher weigher) const
+        {
+            xoshiro256 generator;
+            return this->sample(count, weigher, generator);
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement, reproducibly: the same seed always gives the
+        /// same sample of the same list. Elements without a positive weight are never chosen.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+        [[nodiscard]] list sample(const size_t count, const _Weigher weigher, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            return this->sample(count, weigher, generator);
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement, drawing on the given random number generator.
+        /// Elements without a positive weight are never chosen.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <
+            typename _Weigher,
+            typename _Generator,
+            std::enable_if_t<
+                std::conjunction_v<
+                    detail::is_weigher<_Weigher, _Type>,
+                    std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list sample(const size_t count, const _Weigher weigher, _Generator&& generator) const
+        {
+            list result = list(this->get_allocator());
+            result.reserve(std::min(count, this->size()));
+            detail::weighted_sample(this->begin(), this->size(), count, weigher, generator, [&result](const _Type& elem) -> void { result.push_back(elem); });
+            return result;
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement, weighing each element by the given member.
+        /// Elements without a positive weight are never chosen. Takes a single pass.
+        /// </summary>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list sample(const size_t count, const _Callable member, const _Args&... args) const
+        {
+            return this->sample(count, [&member, &args...](const _Type& elem) -> double { return (double)std::invoke(member, elem, args...); });
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement, weighing each element by the given member,
+        /// which takes no arguments, reproducibly: the same seed always gives the same sample of the same list.
+        /// </summary>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <
+            typename _Callable,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list sample(const size_t count, const _Callable member, const std::uint64_t seed) const
+        {
+            return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, seed);
+        }
+
+        /// <summary>
+        /// Copies a weighted random sample of elements into a new list, without replacement, weighing each element by the given member,
+        /// which takes no arguments, and drawing on the given random number generator.
+        /// </summary>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of elements to choose.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>A new list of the chosen elements, in the order they appear in this list.</returns>
+        template <
+            typename _Callable,
+            typename _Generator,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>,
+                    std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list sample(const size_t count, const _Callable member, _Generator&& generator) const
+        {
+            return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, generator);
+        }
+
+
+        ///////////////
+        /// REVERSE ///
+        ///////////////
+
+        /// <summary>
+        /// Reverses the order of elements in this list, and returns the result.
+        /// </summary>
+        [[nodiscard]] list reverse() const&
+        {
+            return list(this->rbegin(), this->rend(), this->get_allocator());
+        }
+
+        /// <summary>
+        /// Reverses the order of elements in this temporary list in place, and returns the result.
+        /// </summary>
+        [[nodiscard]] list reverse() &&
+        {
+            std::reverse(this->begin(), this->end());
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Makes a read-only view of the elements of this list in reverse order, without copying them. The view must not outlive this list,
+        /// and is invalidated by anything which reallocates or shifts its elements.
+        /// </summary>
+        [[nodiscard]] reverse_view<_Type, _Alloc> reverseView() const
+        {
+            return reverse_view<_Type, _Alloc>(this->data(), this->size(), this->get_allocator());
+        }
+
+
+        /////////////////
+        /// POWER SET ///
+        /////////////////
+
+        /// <summary>
+        /// Returns a list of every subset of the distinct elements of this list.
+        /// </summary>
+        rebind_list<list> powerSet() const
+        {
+            // Each subset is built once, straight into its place, rather than copied on every doubling
+            return this->lazyPowerSet().toList();
+        }
+
+        /// <summary>
+        /// Generates the power set of the distinct elements of this list one subset at a time, in the same order as powerSet().
+        /// Throws std::length_error if there are 64 or more distinct elements.
+        /// </summary>
+        /// <returns>A generator of the subsets, which can be iterated, indexed, or split into ranges.</returns>
+        [[nodiscard]] power_set_generator<_Type, _Alloc> lazyPowerSet() const
+        {
+            return power_set_generator<_Type, _Alloc>(this->removeDuplicates());
+        }
+
+
+        ///////////////
+        /// MIN/MAX ///
+        ///////////////
+        
+        /// <summary>
+        /// Finds the maximum under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison function.</param>
+        /// <returns>The greatest element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] _Type max(const _Compare comparer) const
+        {
+            return *std::max_element(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+        }
+
+        /// <summary>
+        /// Finds the maximum under a default comparison.
+        /// </summary>
+        /// <returns>The greatest element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
+        [[nodiscard]] _Type max() const
+        {
+            if constexpr (detail::simd::is_orderable_v<_Type>)
+            {
+                if (!this->empty())
+                    return detail::simd::extreme<_Type, true>(this->data(), this->size());
+            }
+            return *std::max_element(this->begin(), this->end());
+        }
+
+        /// <summary>
+        /// Finds the minimum under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison function.</param>
+        /// <returns>The least element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] _Type min(const _Compare comparer) const
+        {
+            return *std::min_element(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+        }
+
+        /// <summary>
+        /// Finds the minimum under a default comparison.
+        /// </summary>
+        /// <returns>The least element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
+        [[nodiscard]] _Type min() const
+        {
+            if constexpr (detail::simd::is_orderable_v<_Type>)
+            {
+                if (!this->empty())
+                    return detail::simd::extreme<_Type, false>(this->data(), this->size());
+            }
+            return *std::min_element(this->begin(), this->end());
+        }
+
+
+        ////////////////////////////
+        /// MINMAX, TOP & BOTTOM ///
+        ////////////////////////////
+
+        /// <summary>
+        /// Finds both the minimum and the maximum in a single pass under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>A pair of the first least and the first greatest element, as min and max would give. The list must not be empty.</returns>
+        template <
+            typename _Compare,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] std::pair<_Type, _Type> minmax(const _Compare comparer) const
+        {
+            return this->extremesBy([this, &comparer](size_t lhs, size_t rhs) -> bool { return comparer((*this)[lhs], (*this)[rhs]); });
+        }
+
+        /// <summary>
+        /// Finds both the minimum and the maximum in a single pass under a default comparison.
+        /// </summary>
+        /// <returns>A pair of the first least and the first greatest element, as min and max would give. The list must not be empty.</returns>
+        [[nodiscard]] std::pair<_Type, _Type> minmax() const
+        {
+            return this->minmax(std::less<>{});
+        }
+
+        /// <summary>
+        /// Finds both the minimum and the maximum in a single pass under the given comparison on a specified member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pair of the first least and the first greatest element, as min and max would give. The list must not be empty.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    std::is_member_pointer<_Callable>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] std::pair<_Type, _Type> minmax(const _Compare comparer, const _Callable member, const _Args&... args) const
+        {
+            const auto keys = this->keysOf(member, args...);
+            return this->extremesBy([&keys, &comparer](size_t lhs, size_t rhs) -> bool { return comparer(keys[lhs], keys[rhs]); });
+        }
+
+        /// <summary>
+        /// Finds both the minimum and the maximum in a single pass under a default comparison on a specified member.
+        /// </summary>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pair of the first least and the first greatest element, as min and max would give. The list must not be empty.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_member_pointer_v<_Callable>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] std::pair<_Type, _Type> minmax(const _Callable member, const _Args&... args) const
+        {
+            return this->minmax(std::less<>{}, member, args...);
+        }
+
+        /// <summary>
+        /// Selects the k greatest elements under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>The k greatest elements, greatest first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Compare,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list top(const size_t k, const _Compare comparer) const
+        {
+            return this->bestOf(k, [this, &comparer](size_t lhs, size_t rhs) -> bool { return comparer((*this)[rhs], (*this)[lhs]); });
+        }
+
+        /// <summary>
+        /// Selects the k greatest elements under a default comparison.
+        /// </summary>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <returns>The k greatest elements, greatest first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        [[nodiscard]] list top(const size_t k) const
+        {
+            return this->top(k, std::less<>{});
+        }
+
+        /// <summary>
+        /// Selects the k greatest elements under the given comparison on a specified member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The k greatest elements, greatest first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    std::is_member_pointer<_Callable>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list top(const size_t k, const _Compare comparer, const _Callable member, const _Args&... args) const
+        {
+            const auto keys = this->keysOf(member, args...);
+            return this->bestOf(k, [&keys, &comparer](size_t lhs, size_t rhs) -> bool { return comparer(keys[rhs], keys[lhs]); });
+        }
+
+        /// <summary>
+        /// Selects the k greatest elements under a default comparison on a specified member.
+        /// </summary>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The k greatest elements, greatest first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_member_pointer_v<_Callable>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list top(const size_t k, const _Callable member, const _Args&... args) const
+        {
+            return this->top(k, std::less<>{}, member, args...);
+        }
+
+        /// <summary>
+        /// Selects the k least elements under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>The k least elements, least first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Compare,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list bottom(const size_t k, const _Compare comparer) const
+        {
+            return this->bestOf(k, [this, &comparer](size_t lhs, size_t rhs) -> bool { return comparer((*this)[lhs], (*this)[rhs]); });
+        }
+
+        /// <summary>
+        /// Selects the k least elements under a default comparison.
+        /// </summary>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <returns>The k least elements, least first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        [[nodiscard]] list bottom(const size_t k) const
+        {
+            return this->bottom(k, std::less<>{});
+        }
+
+        /// <summary>
+        /// Selects the k least elements under the given comparison on a specified member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The k least elements, least first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    std::is_member_pointer<_Callable>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list bottom(const size_t k, const _Compare comparer, const _Callable member, const _Args&... args) const
+        {
+            const auto keys = this->keysOf(member, args...);
+            return this->bestOf(k, [&keys, &comparer](size_t lhs, size_t rhs) -> bool { return comparer(keys[lhs], keys[rhs]); });
+        }
+
+        /// <summary>
+        /// Selects the k least elements under a default comparison on a specified member.
+        /// </summary>
+        /// <param name="k">The number of elements to take. If the list is shorter, every element is taken.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The k least elements, least first. Of equal elements, those earlier in this list are taken and listed first.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_member_pointer_v<_Callable>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] list bottom(const size_t k, const _Callable member, const _Args&... args) const
+        {
+            return this->bottom(k, std::less<>{}, member, args...);
+        }
+
+        /// <summary>
+        /// Finds the element which would be at the given position if the list were sorted under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="n">The position in sorted order. A negative value counts back from the end.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <returns>The element at that position in sorted order. Throws std::out_of_range if there is no such position.</returns>
+        template <
+            typename _Compare,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] _Type nth(const long n, const _Compare comparer) const
+        {
+            return (*this)[this->nthBy(n, [this, &comparer](size_t lhs, size_t rhs) -> bool { return comparer((*this)[lhs], (*this)[rhs]); })];
+        }
+
+        /// <summary>
+        /// Finds the element which would be at the given position if the list were sorted under a default comparison.
+        /// </summary>
+        /// <param name="n">The position in sorted order. A negative value counts back from the end.</param>
+        /// <returns>The element at that position in sorted order. Throws std::out_of_range if there is no such position.</returns>
+        [[nodiscard]] _Type nth(const long n) const
+        {
+            return this->nth(n, std::less<>{});
+        }
+
+        /// <summary>
+        /// Finds the element which would be at the given position if the list were sorted under the given comparison on a specified member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="n">The position in sorted order. A negative value counts back from the end.</param>
+        /// <param name="comparer">The comparison to order by.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The element at that position in sorted order. Throws std::out_of_range if there is no such position.</returns>
+        template <
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Compare>>,
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    std::is_member_pointer<_Callable>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] _Type nth(const long n, const _Compare comparer, const _Callable member, const _Args&... args) const
+        {
+            const auto keys = this->keysOf(member, args...);
+            return (*this)[this->nthBy(n, [&keys, &comparer](size_t lhs, size_t rhs) -> bool { return comparer(keys[lhs], keys[rhs]); })];
+        }
+
+        /// <summary>
+        /// Finds the element which would be at the given position if the list were sorted under a default comparison on a specified member.
+        /// </summary>
+        /// <param name="n">The position in sorted order. A negative value counts back from the end.</param>
+        /// <param name="member">A reference to the member variable or method to order on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The element at that position in sorted order. Throws std::out_of_range if there is no such position.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_member_pointer_v<_Callable>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] _Type nth(const long n, const _Callable member, const _Args&... args) const
+        {
+            return this->nth(n, std::less<>{}, member, args...);
+        }
+
+    private:
+        /// <summary>
+        /// Computes the given member of every element, in order.
+        /// </summary>
+        template <typename _Callable, typename... _Args>
+        auto keysOf(const _Callable& member, const _Args&... args) const
+        {
+            std::vector<std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>> keys;
+            keys.reserve(this->size());
+            for (const _Type& elem : *this)
+                keys.push_back(std::invoke(member, elem, args...));
+            return keys;
+        }
+
+        /// <summary>
+        /// Finds the first least and first greatest elements in one pass, given a strict ordering on indices.
+        /// </summary>
+        template <typename _Less>
+        std::pair<_Type, _Type> extremesBy(const _Less& less) const
+        {
+            size_t least = 0, greatest = 0;
+            for (size_t i = 1; i < this->size(); i++)
+            {
+                if (less(i, least))
+                    least = i;
+                else if (less(greatest, i))
+                    greatest = i;
+            }
+            return std::pair<_Type, _Type>((*this)[least], (*this)[greatest]);
+        }
+
+        /// <summary>
+        /// Selects the first k elements in the given order, by keeping a heap of the best k indices seen so far. O(n log k).
+        /// </summary>
+        /// <param name="k">The number of elements to select.</param>
+        /// <param name="before">A strict ordering on indices: true if the element at the first index should come before the element at the second.</param>
+        template <typename _Before>
+        list bestOf(size_t k, const _Before& before) const
+        {
+            // Break ties by position, so the selection is the same as the start of a stable sort
+            auto ranked = [&before](size_t lhs, size_t rhs) -> bool { return before(lhs, rhs) || (!before(rhs, lhs) && lhs < rhs); };
+
+            k = std::min(k, this->size());
+            std::vector<size_t> heap;
+            heap.reserve(k);
+            for (size_t i = 0; i < this->size() && k > 0; i++)
+            {
+                if (heap.size() < k)
+                {
+                    heap.push_back(i);
+                    std::push_heap(heap.begin(), heap.end(), ranked);
+                }
+                else if (ranked(i, heap.front()))
+                {
+                    // The front of the heap is the worst kept so far
+                    std::pop_heap(heap.begin(), heap.end(), ranked);
+                    heap.back() = i;
+                    std::push_heap(heap.begin(), heap.end(), ranked);
+                }
+            }
+            std::sort_heap(heap.begin(), heap.end(), ranked);
+
+            list result = list(this->get_allocator());
+            result.reserve(k);
+            for (size_t i : heap)
+                result.push_back((*this)[i]);
+            return result;
+        }
+
+        /// <summary>
+        /// Finds the index of the element which would be at position n in sorted order, by partial selection. O(n) on average.
+        /// </summary>
+        template <typename _Less>
+        size_t nthBy(const long n, const _Less& less) const
+        {
+            const long position = (n < 0 ? (long)this->size() + n : n);
+            if (position < 0 || (size_t)position >= this->size())
+                throw std::out_of_range("easy_list::list::nth: position out of range");
+            std::vector<size_t> order(this->size());
+            std::iota(order.begin(), order.end(), (size_t)0);
+            std::nth_element(order.begin(), order.begin() + position, order.end(), less);
+            return order[position];
+        }
+
+    public:
+
+    };
+
+    /// <summary>
+    /// A lazy sequence of elements, built by chaining operations onto list::lazy().
+    /// No element is copied, and no storage allocated, until the pipeline is materialised with toList() or aggregated.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements yielded by the pipeline.</typeparam>
+    /// <typeparam name="_Producer">A callable object which feeds each element in turn to a sink, stopping early if the sink returns false.</typeparam>
+    /// <typeparam name="_Alloc">The allocator of the source list, rebound to the elements yielded, with which results are built.</typeparam>
+    template <typename _Type, typename _Producer, typename _Alloc>
+    class pipeline
+    {
+    public:
+        using value_type = _Type;
+        using allocator_type = _Alloc;
+
+        explicit pipeline(const _Producer& producer, const _Alloc& _Al = _Alloc()) : producer(producer), allocator(_Al) {}
+
+        /// <summary>
+        /// The allocator results are built with: that of the list the pipeline was started from.
+        /// </summary>
+        [[nodiscard]] _Alloc get_allocator() const { return this->allocator; }
+
+    private:
+        _Producer producer;
+        _Alloc allocator;
+
+        template <typename _NewType, typename _NewProducer>
+        auto make(const _NewProducer& newProducer) const
+        {
+            using _NewAlloc = typename std::allocator_traits<_Alloc>::template rebind_alloc<_NewType>;
+            return pipeline<_NewType, _NewProducer, _NewAlloc>(newProducer, _NewAlloc(this->allocator));
+        }
+
+    public:
+        /////////////////
+        /// SELECTING ///
+        /////////////////
+
+        /// <summary>
+        /// Lazily selects the elements equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this pipeline.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A pipeline yielding only those elements equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] auto select(const _MatchType& match) const
+        {
+            return this->select([match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Lazily selects the elements satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A pipeline yielding only those elements satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] auto select(const _Predicate predicate) const
+        {
+            auto newProducer = [source = this->producer, predicate](auto&& sink) -> void {
+                source([&sink, &predicate](auto&& elem) -> bool {
+                    return !predicate(elem) || sink(std::forward<decltype(elem)>(elem));
+                });
+            };
+            return this->template make<_Type>(newProducer);
+        }
+
+        /// <summary>
+        /// Lazily selects the elements where the given member equals the provided match.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pipeline yielding only those elements where the given member equals the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] auto select(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->select([match, member, args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+        /// <summary>
+        /// Lazily removes the elements equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this pipeline.</typeparam>
+        /// <param name="match">The element to remove.</param>
+        /// <returns>A pipeline yielding only those elements not equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] auto removeAll(const _MatchType& match) const
+        {
+            return this->select([match](const _Type& other) -> bool { return !(other == match); });
+        }
+
+        /// <summary>
+        /// Lazily removes the elements satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A pipeline yielding only those elements failing the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] auto removeAll(const _Predicate predicate) const
+        {
+            return this->select([predicate](const _Type& other) -> bool { return !predicate(other); });
+        }
+
+        /// <summary>
+        /// Lazily removes the elements where the given member equals the provided match.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to (not) match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pipeline yielding only those elements where the given member doesn't equal the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] auto removeAll(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->select([match, member, args...](const _Type& other) -> bool { return !(std::invoke(member, other, args...) == match); });
+        }
+
+
+        ////////////////////
+        /// TRANSFORMING ///
+        ////////////////////
+
+        /// <summary>
+        /// Lazily converts each element into the given type.
+        /// </summary>
+        /// <typeparam name="_ConvertibleType">A type to which the elements of this pipeline are convertible.</typeparam>
+        /// <returns>A pipeline yielding the converted elements.</returns>
+        template<class _ConvertibleType, std::enable_if_t<std::is_convertible_v<_Type, _ConvertibleType>, bool> = true>
+        [[nodiscard]] auto transform() const
+        {
+            return this->transform([](const _Type& elem) -> _ConvertibleType { return static_cast<_ConvertibleType>(elem); });
+        }
+
+        /// <summary>
+        /// Lazily converts each element to a new element by use of the given transformer.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object type, which takes elements of this pipeline as arguments and returns elements of the result of the transformation.</typeparam>
+        /// <param name="transformer">The transformation to apply to each element.</param>
+        /// <param name="...args">The arguments to supply to the transformer, if applicable.</param>
+        /// <returns>A pipeline yielding the transformed elements.</returns>
+        template <
+            typename _Transformer,
+            typename... _Args,
+            typename _Result = std::decay_t<std::invoke_result_t<const _Transformer&, const _Type&, const _Args&...>>
+        >
+        [[nodiscard]] auto transform(const _Transformer transformer, const _Args&... args) const
+        {
+            auto newProducer = [source = this->producer, transformer, args...](auto&& sink) -> void {
+                source([&](auto&& elem) -> bool {
+                    return sink(_Result(std::invoke(transformer, elem, args...)));
+                });
+            };
+            return this->template make<_Result>(newProducer);
+        }
+
+
+        ///////////////
+        /// REPLACE ///
+        ///////////////
+
+        /// <summary>
+        /// Lazily replaces each element equal to the given match with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this pipeline.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this pipeline.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] auto replace(_Replacer replacement, const _MatchType& match) const
+        {
+            return this->replaceWhere(
+                [replacement](const _Type&) -> _Type { return replacement; },
+                [match](const _Type& other) -> bool { return other == match; }
+            );
+        }
+
+        /// <summary>
+        /// Lazily replaces each element satisfying the given predicate with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this pipeline.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] auto replace(_Replacer replacement, const _Predicate predicate) const
+        {
+            return this->replaceWhere([replacement](const _Type&) -> _Type { return replacement; }, predicate);
+        }
+
+        /// <summary>
+        /// Lazily replaces each element matching the specified value on the specified member with the specified value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this pipeline.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] auto replace(_Replacer replacement, const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->replaceWhere(
+                [replacement](const _Type&) -> _Type { return replacement; },
+                [match, member, args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+        /// With transformer ///
+
+        /// <summary>
+        /// Lazily transforms each element equal to the given match.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this pipeline as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this pipeline.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] auto replace(const _Transformer transformer, const _MatchType& match) const
+        {
+            return this->replaceWhere(transformer, [match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Lazily transforms each element satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this pipeline as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] auto replace(const _Transformer transformer, const _Predicate predicate) const
+        {
+            return this->replaceWhere(transformer, predicate);
+        }
+
+        /// <summary>
+        /// Lazily transforms each element matching the specified value on the specified member.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this pipeline as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A pipeline yielding the result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] auto replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->replaceWhere(
+                transformer,
+                [match, member, args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+    private:
+        template <typename _Transformer, typename _Predicate>
+        auto replaceWhere(const _Transformer transformer, const _Predicate predicate) const
+        {
+            auto newProducer = [source = this->producer, transformer, predicate](auto&& sink) -> void {
+                source([&](auto&& elem) -> bool {
+                    if (predicate(elem))
+                        return sink(_Type(std::invoke(transformer, elem)));
+                    return sink(std::forward<decltype(elem)>(elem));
+                });
+            };
+            return this->template make<_Type>(newProducer);
+        }
+
+    public:
+        ///////////////////
+        /// AGGREGATING ///
+        ///////////////////
+
+        /// <summary>
+        /// Runs the pipeline, passing each element to the given function.
+        /// </summary>
+        /// <typeparam name="_Function">A callable object taking an element of this pipeline.</typeparam>
+        /// <param name="function">The function to call on each element.</param>
+        template <typename _Function>
+        void forEach(_Function function) const
+        {
+            this->producer([&function](auto&& elem) -> bool {
+                function(std::forward<decltype(elem)>(elem));
+                return true;
+            });
+        }
+
+        /// <summary>
+        /// Runs the pipeline, collecting its elements into a new list, built with the source list's allocator.
+        /// </summary>
+        /// <returns>A list of every element yielded by the pipeline, in order.</returns>
+        [[nodiscard]] list<_Type, _Alloc> toList() const
+        {
+            return this->toList(this->allocator);
+        }
+
+        /// <summary>
+        /// Runs the pipeline, collecting its elements into a new list.
+        /// </summary>
+        /// <typeparam name="_OtherAlloc">The element allocator of the new list.</typeparam>
+        /// <param name="_Al">The allocator to build the new list with, e.g. one drawing on an arena.</param>
+        /// <returns>A list of every element yielded by the pipeline, in order.</returns>
+        template <typename _OtherAlloc>
+        [[nodiscard]] list<_Type, _OtherAlloc> toList(const _OtherAlloc& _Al) const
+        {
+            list<_Type, _OtherAlloc> result = list<_Type, _OtherAlloc>(_Al);
+            this->producer([&result](auto&& elem) -> bool {
+                result.push_back(std::forward<decltype(elem)>(elem));
+                return true;
+            });
+            return result;
+        }
+
+        /// <summary>
+        /// Runs the pipeline, counting the elements it yields.
+        /// </summary>
+        /// <returns>The number of elements yielded by the pipeline.</returns>
+        [[nodiscard]] size_t count() const
+        {
+            size_t n = 0;
+            this->producer([&n](auto&&) -> bool {
+                n++;
+                return true;
+            });
+            return n;
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a random sample of the elements it yields, each as likely to be kept as any other, without knowing
+        /// in advance how many there will be. Only the elements kept are copied, and most of the rest cost no random numbers.
+        /// Every call gives a different sample.
+        /// </summary>
+        /// <param name="count">The number of elements to keep. Every element is kept if the pipeline yields no more.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count) const
+        {
+            return this->sample(count, detail::fresh_seed());
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a random sample of the elements it yields, reproducibly: the same seed always gives the same sample of the same elements.
+        /// </summary>
+        /// <param name="count">The number of elements to keep. Every element is kept if the pipeline yields no more.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            detail::reservoir<_Type, xoshiro256> kept(count, generator);
+            this->producer([&kept](auto&& elem) -> bool {
+                kept.offer(std::forward<decltype(elem)>(elem));
+                return true;
+            });
+            list<_Type, _Alloc> result = list<_Type, _Alloc>(this->allocator);
+            kept.drain([&result](_Type&& elem) -> void { result.push_back(std::move(elem)); });
+            return result;
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement: each element is kept with a
+        /// likelihood in proportion to its weight among those not yet kept. Elements without a positive weight are never kept.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Weigher weigher) const
+        {
+            xoshiro256 generator;
+            return this->sample(count, weigher, generator);
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement, reproducibly: the same seed always gives the same sample
+        /// of the same elements. Elements without a positive weight are never kept.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Weigher weigher, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            return this->sample(count, weigher, generator);
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement, drawing on the given random number generator.
+        /// Elements without a positive weight are never kept.
+        /// </summary>
+        /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="weigher">The function giving the weight of each element.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <
+            typename _Weigher,
+            typename _Generator,
+            std::enable_if_t<
+                std::conjunction_v<
+                    detail::is_weigher<_Weigher, _Type>,
+                    std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Weigher weigher, _Generator&& generator) const
+        {
+            detail::weighted_reservoir<_Type, std::remove_reference_t<_Generator>> kept(count, generator);
+            this->producer([&kept, &weigher](auto&& elem) -> bool {
+                const double weight = (double)weigher(elem);
+                kept.offer(std::forward<decltype(elem)>(elem), weight);
+                return true;
+            });
+            list<_Type, _Alloc> result = list<_Type, _Alloc>(this->allocator);
+            kept.drain([&result](_Type&& elem) -> void { result.push_back(std::move(elem)); });
+            return result;
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement, weighing each element by the
+        /// given member. Elements without a positive weight are never kept.
+        /// </summary>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Callable member, const _Args&... args) const
+        {
+            return this->sample(count, [&member, &args...](const _Type& elem) -> double { return (double)std::invoke(member, elem, args...); });
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement, weighing each element by the given member, which takes
+        /// no arguments, reproducibly: the same seed always gives the same sample of the same elements.
+        /// </summary>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <
+            typename _Callable,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Callable member, const std::uint64_t seed) const
+        {
+            return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, seed);
+        }
+
+        /// <summary>
+        /// Runs the pipeline, keeping a weighted random sample of the elements it yields, without replacement, weighing each element by the given member, which takes
+        /// no arguments, and drawing on the given random number generator.
+        /// </summary>
+        /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+        /// <param name="count">The number of elements to keep.</param>
+        /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+        /// <param name="generator">The random number generator, which is advanced.</param>
+        /// <returns>A list of the elements kept, in the order they were yielded.</returns>
+        template <
+            typename _Callable,
+            typename _Generator,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>,
+                    std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] list<_Type, _Alloc> sample(const size_t count, const _Callable member, _Generator&& generator) const
+        {
+            return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, generator);
+        }
+
+        /// <summary>
+        /// Runs the pipeline until an element equal to the given match is found.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this pipeline.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>True if a match was found, false otherwise.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _MatchType& match) const
+        {
+            return this->contains([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Runs the pipeline until an element satisfying the given predicate is found.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>True if any element satisfies the given predicate, false otherwise.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _Predicate predicate) const
+        {
+            bool found = false;
+            this->producer([&found, &predicate](auto&& elem) -> bool {
+                found = predicate(elem);
+                return !found;
+            });
+            return found;
+        }
+
+        /// <summary>
+        /// Runs the pipeline, finding the maximum under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison function.</param>
+        /// <returns>The first greatest element yielded. Throws std::bad_optional_access if the pipeline yields no elements.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] _Type max(const _Compare comparer) const
+        {
+            std::optional<_Type> best;
+            this->producer([&best, &comparer](auto&& elem) -> bool {
+                if (!best.has_value() || comparer(*best, elem))
+                    best.emplace(std::forward<decltype(elem)>(elem));
+                return true;
+            });
+            return best.value();
+        }
+
+        /// <summary>
+        /// Runs the pipeline, finding the maximum under a default comparison.
+        /// </summary>
+        /// <returns>The first greatest element yielded. Throws std::bad_optional_access if the pipeline yields no elements.</returns>
+        [[nodiscard]] _Type max() const
+        {
+            return this->max(std::less<>{});
+        }
+
+        /// <summary>
+        /// Runs the pipeline, finding the minimum under the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison function.</param>
+        /// <returns>The first least element yielded. Throws std::bad_optional_access if the pipeline yields no elements.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        [[nodiscard]] _Type min(const _Compare comparer) const
+        {
+            std::optional<_Type> best;
+            this->producer([&best, &comparer](auto&& elem) -> bool {
+                if (!best.has_value() || comparer(elem, *best))
+                    best.emplace(std::forward<decltype(elem)>(elem));
+                return true;
+            });
+            return best.value();
+        }
+
+        /// <summary>
+        /// Runs the pipeline, finding the minimum under a default comparison.
+        /// </summary>
+        /// <returns>The first least element yielded. Throws std::bad_optional_access if the pipeline yields no elements.</returns>
+        [[nodiscard]] _Type min() const
+        {
+            return this->min(std::less<>{});
+        }
+    };
+
+    /// <summary>
+    /// Parallel versions of list operations, obtained from list::par(). Results are identical to the serial operations:
+    /// selections, transformations and replacements keep the order of the list, and searches find the first match.
+    /// Results are built with the list's allocator on several threads at once, so it must be safe to allocate from concurrently,
+    /// as std::allocator and std::pmr::synchronized_pool_resource are, but an arena isn't.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Alloc>
+    class parallel
+    {
+    public:
+        using source_type = list<_Type, _Alloc>;
+        using const_iterator = typename source_type::const_iterator;
+        template <typename _Other> using rebind_list = typename source_type::template rebind_list<_Other>;
+
+        explicit parallel(const source_type& source) : source(&source) {}
+
+    private:
+        const source_type* source;
+
+        template <typename _Predicate>
+        const_iterator searchWhere(const _Predicate& predicate) const
+        {
+            const size_t size = this->source->size();
+            std::atomic<size_t> found(size);
+            detail::parallel_chunks(size, detail::parallel_chunk_count(size), [this, &predicate, &found](size_t, size_t first, size_t last) -> void {
+                for (size_t i = first; i < last && i < found.load(std::memory_order_relaxed); i++)
+                {
+                    if (predicate((*this->source)[i]))
+                    {
+                        size_t current = found.load(std::memory_order_relaxed);
+                        while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+                        return;
+                    }
+                }
+            });
+            return this->source->begin() + found.load();
+        }
+
+        template <typename _Predicate>
+        source_type selectWhere(const _Predicate& predicate) const
+        {
+            const size_t chunks = detail::parallel_chunk_count(this->source->size());
+            std::vector<source_type> parts = this->makeParts<source_type>(chunks);
+            detail::parallel_chunks(this->source->size(), chunks, [this, &predicate, &parts](size_t chunk, size_t first, size_t last) -> void {
+                for (size_t i = first; i < last; i++)
+                {
+                    if (predicate((*this->source)[i]))
+                        parts[chunk].push_back((*this->source)[i]);
+                }
+            });
+            return parallel::concatenate(parts, this->source->get_allocator());
+        }
+
+        template <typename _Predicate>
+        size_t countWhere(const _Predicate& predicate) const
+        {
+            const size_t chunks = detail::parallel_chunk_count(this->source->size());
+            std::vector<size_t> counts(chunks, 0);
+            detail::parallel_chunks(this->source->size(), chunks, [this, &predicate, &counts](size_t chunk, size_t first, size_t last) -> void {
+                size_t n = 0;
+                for (size_t i = first; i < last; i++)
+                {
+                    if (predicate((*this->source)[i]))
+                        n++;
+                }
+                counts[chunk] = n;
+            });
+            return std::accumulate(counts.begin(), counts.end(), (size_t)0);
+        }
+
+        template <typename _Result, typename _Transformer>
+        rebind_list<_Result> transformWith(const _Transformer& transformer) const
+        {
+            const size_t chunks = detail::parallel_chunk_count(this->source->size());
+            std::vector<rebind_list<_Result>> parts = this->makeParts<rebind_list<_Result>>(chunks);
+            detail::parallel_chunks(this->source->size(), chunks, [this, &transformer, &parts](size_t chunk, size_t first, size_t last) -> void {
+                parts[chunk].reserve(last - first);
+                for (size_t i = first; i < last; i++)
+                    parts[chunk].push_back(transformer((*this->source)[i]));
+            });
+            return parallel::concatenate(parts, this->source->get_allocator());
+        }
+
+        template <typename _Transformer, typename _Predicate>
+        source_type replaceWhere(const _Transformer& transformer, const _Predicate& predicate) const
+        {
+            if constexpr (std::is_default_constructible_v<_Type> && std::is_copy_assignable_v<_Type>)
+            {
+                // Each chunk copies its own elements into place, replaced or not, so no one thread copies the whole list
+                const size_t size = this->source->size();
+                source_type result = source_type(this->source->get_allocator());
+                result.resize(size);
+                detail::parallel_chunks(size, detail::parallel_chunk_count(size), [this, &result, &transformer, &predicate](size_t, size_t first, size_t last) -> void {
+                    for (size_t i = first; i < last; i++)
+                    {
+                        const _Type& elem = (*this->source)[i];
+                        if (predicate(elem))
+                            result[i] = std::invoke(transformer, elem);
+                        else
+                            result[i] = elem;
+                    }
+                });
+                return result;
+            }
+            else
+            {
+                return this->transformWith<_Type>([&transformer, &predicate](const _Type& elem) -> _Type {
+                    return predicate(elem) ? _Type(std::invoke(transformer, elem)) : elem;
+                });
+            }
+        }
+
+        /// <summary>
+        /// Makes an empty list for each chunk's results, each with the source list's allocator.
+        /// </summary>
+        template <typename _List>
+        std::vector<_List> makeParts(const size_t chunks) const
+        {
+            std::vector<_List> parts;
+            parts.reserve(chunks);
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+                parts.emplace_back(typename _List::allocator_type(this->source->get_allocator()));
+            return parts;
+        }
+
+        /// <summary>
+        /// Joins the chunks' results into one list using the source list's allocator.
+        /// </summary>
+        template <typename _List, typename _SourceAlloc>
+        static _List concatenate(std::vector<_List>& parts, const _SourceAlloc& _Al)
+        {
+            size_t total = 0;
+            for (const _List& part : parts)
+                total += part.size();
+            _List result = _List(typename _List::allocator_type(_Al));
+            result.reserve(total);
+            for (size_t chunk = 0; chunk < parts.size(); chunk++)
+                result.insert(result.end(), std::make_move_iterator(parts[chunk].begin()), std::make_move_iterator(parts[chunk].end()));
+            return result;
+        }
+
+    public:
+        /////////////////
+        /// SEARCHING ///
+        /////////////////
+
+        /// <summary>
+        /// Searches for an exact match, in parallel.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of the list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A const iterator to the first element found equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                bool
+            > = true
+        >
+        [[nodiscard]] const_iterator search(const _MatchType& match) const
+        {
+            return this->searchWhere([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Searches for an element satisfying the given predicate, in parallel.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A const iterator to the first element found to satisfy the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] const_iterator search(const _Predicate predicate) const
+        {
+            return this->searchWhere(predicate);
+        }
+
+        /// <summary>
+        /// Searches for an element with a member matching the given value, in parallel.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to check against.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A const iterator to the first element found, such that the given member variable or method returned the match provided.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] const_iterator search(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->searchWhere([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+
+        /////////////////
+        /// SELECTING ///
+        /////////////////
+
+        /// <summary>
+        /// Selects, in parallel, a sub-list containing all elements of the list equal to the provided match.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of the list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>A sub-list containing all elements of the list equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] source_type select(const _MatchType& match) const
+        {
+            return this->selectWhere([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Selects, in parallel, a sub-list containing all elements of the list satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list containing all elements of the list satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] source_type select(const _Predicate predicate) const
+        {
+            return this->selectWhere(predicate);
+        }
+
+        /// <summary>
+        /// Selects, in parallel, a sub-list containing all elements of the list where the given member equals the provided match.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A sub-list containing all elements of the list where the given member equals the provided match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] source_type select(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->selectWhere([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+
+        ////////////////
+        /// COUNTING ///
+        ////////////////
+
+        /// <summary>
+        /// Finds, in parallel, the number of elements matching the specified value.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of the list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>The number of elements matching the specified value.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _MatchType& match) const
+        {
+            return this->countWhere([&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Counts, in parallel, the number of elements satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The number of elements satisfying the given predicate.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_same<_Type, _Predicate>>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _Predicate predicate) const
+        {
+            return this->countWhere(predicate);
+        }
+
+        /// <summary>
+        /// Counts, in parallel, the number of elements matching the given value on the given member.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The number of elements matching the given value on the given member.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->countWhere([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+        }
+
+
+        ////////////////////
+        /// TRANSFORMING ///
+        ////////////////////
+
+        /// <summary>
+        /// Makes a new list, in parallel, converting each element of the list into the given type.
+        /// </summary>
+        /// <typeparam name="_ConvertibleType">A type to which the elements of the list are convertible.</typeparam>
+        /// <returns>The result of the transformation.</returns>
+        template<class _ConvertibleType, std::enable_if_t<std::is_convertible_v<_Type, _ConvertibleType>, bool> = true>
+        [[nodiscard]] rebind_list<_ConvertibleType> transform() const
+        {
+            return this->template transformWith<_ConvertibleType>([](const _Type& elem) -> _ConvertibleType { return static_cast<_ConvertibleType>(elem); });
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, converting each element of the list to a new element by use of the given transformer.
+        /// </summary>
+        /// <typeparam name="_Result">The elements of the result of the transformation.</typeparam>
+        /// <typeparam name="_Transformer">A callable object type, which takes elements of the list as arguments and returns elements of the result of the transformation.</typeparam>
+        /// <param name="transformer">The transformation to apply to each element in the list.</param>
+        /// <param name="...args">The arguments to supply to the transformer, if applicable.</param>
+        /// <returns>The result of the transformation.</returns>
+        template <
+            typename _Result,
+            typename _Transformer,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_member_pointer<_Transformer>>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Transformer>()), _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] rebind_list<_Result> transform(const _Transformer transformer, const _Args&... args) const
+        {
+            return this->template transformWith<_Result>([&transformer, &args...](const _Type& elem) -> _Result { return transformer(elem, args...); });
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, converting each element of the list into one of its members.
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="member">A reference to the member variable or method to transform to, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the transformation.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] rebind_list<_Result> transform(const _Callable member, const _Args&... args) const
+        {
+            return this->template transformWith<_Result>([&member, &args...](const _Type& elem) -> _Result { return std::invoke(member, elem, args...); });
+        }
+
+
+        ///////////////
+        /// REPLACE ///
+        ///////////////
+
+        /// <summary>
+        /// Makes a new list, in parallel, by replacing each match found with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of the list.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of the list.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(_Replacer replacement, const _MatchType& match) const
+        {
+            return this->replaceWhere(
+                [&replacement](const _Type&) -> _Type { return replacement; },
+                [&match](const _Type& other) -> bool { return other == match; }
+            );
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, by replacing each element satisfying the given predicate with the given replacement value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of the list.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(_Replacer replacement, const _Predicate predicate) const
+        {
+            return this->replaceWhere([&replacement](const _Type&) -> _Type { return replacement; }, predicate);
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, by replacing each element matching the specified value on the specified member with the specified value.
+        /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of the list.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Replacer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(_Replacer replacement, const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->replaceWhere(
+                [&replacement](const _Type&) -> _Type { return replacement; },
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+        /// With transformer ///
+
+        /// <summary>
+        /// Makes a new list, in parallel, by transforming each match found.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of the list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of the list.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(const _Transformer transformer, const _MatchType& match) const
+        {
+            return this->replaceWhere(transformer, [&match](const _Type& other) -> bool { return other == match; });
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, by transforming each element satisfying the given predicate.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of the list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(const _Transformer transformer, const _Predicate predicate) const
+        {
+            return this->replaceWhere(transformer, predicate);
+        }
+
+        /// <summary>
+        /// Makes a new list, in parallel, by transforming each element matching the specified value on the specified member.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of the list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        [[nodiscard]] source_type replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->replaceWhere(
+                transformer,
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+    };
+
+    /// <summary>
+    /// A list which keeps its elements in order, obtained from list::toSorted() or constructed directly. Knowing the order, it answers
+    /// searches and counts by binary search, and unifies and disjoins with other sorted lists by a single linear merge.
+    /// Elements are only added or removed through its own methods, so the order can't be broken from outside.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Compare">The comparison object type the elements are ordered by</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Compare, typename _Alloc>
+    class sorted_list
+    {
+    public:
+        using list_type = list<_Type, _Alloc>;
+        using value_type = _Type;
+        using size_type = typename list_type::size_type;
+        using const_iterator = typename list_type::const_iterator;
+        using const_reverse_iterator = typename list_type::const_reverse_iterator;
+
+        ////////////////////
+        /// CONSTRUCTORS ///
+        ////////////////////
+
+        sorted_list() : elements(), comparer() {}
+
+        explicit sorted_list(const _Compare& _Comp) : elements(), comparer(_Comp) {}
+
+        sorted_list(const _Compare& _Comp, const _Alloc& _Al) : elements(_Al), comparer(_Comp) {}
+
+        /// <summary>
+        /// Takes the elements of the given list, and sorts them. Equal elements keep their order.
+        /// </summary>
+        explicit sorted_list(list_type _Right, const _Compare& _Comp = _Compare()) : elements(std::move(_Right)), comparer(_Comp)
+        {
+            this->elements.stableSort(this->comparer);
+        }
+
+        sorted_list(std::initializer_list<_Type> _Ilist, const _Compare& _Comp = _Compare()) : sorted_list(list_type(_Ilist), _Comp) {}
+
+
+        ///////////////////
+        /// CONVERSIONS ///
+        ///////////////////
+
+        /// <summary>
+        /// Copies the elements out, in order, as an ordinary list.
+        /// </summary>
+        [[nodiscard]] list_type toList() const&
+        {
+            return list_type(this->elements, this->elements.get_allocator());
+        }
+
+        /// <summary>
+        /// Moves the elements out, in order, as an ordinary list.
+        /// </summary>
+        [[nodiscard]] list_type toList() &&
+        {
+            return std::move(this->elements);
+        }
+
+        /// <summary>
+        /// The elements, in order, as a read-only ordinary list.
+        /// </summary>
+        [[nodiscard]] const list_type& items() const noexcept { return this->elements; }
+
+        /// <summary>
+        /// The comparison the elements are ordered by.
+        /// </summary>
+        [[nodiscard]] _Compare comparison() const { return this->comparer; }
+
+
+        //////////////
+        /// ACCESS ///
+        //////////////
+
+        [[nodiscard]] const_iterator begin() const noexcept { return this->elements.begin(); }
+        [[nodiscard]] const_iterator end() const noexcept { return this->elements.end(); }
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return this->elements.rbegin(); }
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return this->elements.rend(); }
+        [[nodiscard]] size_type size() const noexcept { return this->elements.size(); }
+        [[nodiscard]] bool empty() const noexcept { return this->elements.empty(); }
+        [[nodiscard]] const _Type& operator[](const size_type index) const { return this->elements[index]; }
+
+        /// <summary>
+        /// Search operations return this if no match was found.
+        /// </summary>
+        /// <returns>An iterator object representing "no match found".</returns>
+        [[nodiscard]] const_iterator npos() const noexcept { return this->end(); }
+
+        /// <summary>
+        /// The element which comes first by the comparison: the least for std::less, and the greatest for std::greater. O(1). The list must not be empty.
+        /// </summary>
+        [[nodiscard]] const _Type& first() const { return this->elements.front(); }
+
+        /// <summary>
+        /// The element which comes last by the comparison: the greatest for std::less, and the least for std::greater. O(1). The list must not be empty.
+        /// </summary>
+        [[nodiscard]] const _Type& last() const { return this->elements.back(); }
+
+
+        ///////////////////////////
+        /// INSERTING & REMOVING ///
+        ///////////////////////////
+
+        /// <summary>
+        /// Inserts an element in order, after any elements equal to it. O(log n) comparisons, plus moving the elements after it.
+        /// </summary>
+        /// <param name="value">The element to insert.</param>
+        /// <returns>A const iterator to the inserted element.</returns>
+        const_iterator insert(const _Type& value)
+        {
+            return this->elements.insert(std::upper_bound(this->elements.cbegin(), this->elements.cend(), value, this->comparer), value);
+        }
+
+        /// <summary>
+        /// Inserts an element in order, after any elements equal to it. O(log n) comparisons, plus moving the elements after it.
+        /// </summary>
+        /// <param name="value">The element to insert.</param>
+        /// <returns>A const iterator to the inserted element.</returns>
+        const_iterator insert(_Type&& value)
+        {
+            auto position = std::upper_bound(this->elements.cbegin(), this->elements.cend(), value, this->comparer);
+            return this->elements.insert(position, std::move(value));
+        }
+
+        /// <summary>
+        /// Inserts many elements at once: they are sorted by themselves, then merged in. Cheaper than inserting them one at a time.
+        /// </summary>
+        /// <typeparam name="_OtherAlloc">The allocator of the list or vector of elements, which needn't be this list's.</typeparam>
+        /// <param name="values">The list or vector of elements to insert.</param>
+        /// <returns>This list, after the insertion.</returns>
+        template <typename _OtherAlloc>
+        sorted_list& insert(const std::vector<_Type, _OtherAlloc>& values)
+        {
+            const size_t middle = this->elements.size();
+            this->elements.insert(this->elements.end(), values.begin(), values.end());
+            std::stable_sort(this->elements.begin() + middle, this->elements.end(), this->comparer);
+            std::inplace_merge(this->elements.begin(), this->elements.begin() + middle, this->elements.end(), this->comparer);
+            return *this;
+        }
+
+        /// <summary>
+        /// Removes every element equal to the provided match. O(log n) comparisons, plus moving the elements after them.
+        /// </summary>
+        /// <param name="match">The value to remove.</param>
+        /// <returns>The number of elements removed.</returns>
+        template <typename _MatchType>
+        size_t remove(const _MatchType& match)
+        {
+            auto range = std::equal_range(this->elements.cbegin(), this->elements.cend(), match, this->comparer);
+            const size_t removed = (size_t)std::distance(range.first, range.second);
+            this->elements.erase(range.first, range.second);
+            return removed;
+        }
+
+        /// <summary>
+        /// Removes the element at the given position.
+        /// </summary>
+        /// <param name="position">A const iterator to the element to remove.</param>
+        /// <returns>A const iterator to the element after the one removed.</returns>
+        const_iterator removeAt(const const_iterator position)
+        {
+            return this->elements.erase(position);
+        }
+
+        /// <summary>
+        /// Removes every element.
+        /// </summary>
+        void clear() noexcept
+        {
+            this->elements.clear();
+        }
+
+
+        /////////////////
+        /// SEARCHING ///
+        /////////////////
+
+        /// <summary>
+        /// Searches for an element equal to the provided match, by binary search.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type which the comparison can order against the type of the elements of this list.</typeparam>
+        /// <param name="match">The value to search for.</param>
+        /// <returns>A const iterator to the first element equal to the match, or npos() if there is none.</returns>
+        template <typename _MatchType>
+        [[nodiscard]] const_iterator search(const _MatchType& match) const
+        {
+            auto found = std::lower_bound(this->begin(), this->end(), match, this->comparer);
+            if (found == this->end() || this->comparer(match, *found))
+                return this->end();
+            return found;
+        }
+
+        /// <summary>
+        /// Searches for an element with a member equal to the given value, by binary search. The list must be ordered by that member, and
+        /// its comparison must be able to order the member's values: either it was made by list::toSorted on that member, or it can compare
+        /// member values directly (as std::less<> and std::greater<> can, for a member that orders the elements as a whole).
+        /// </summary>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to search for.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>A const iterator to the first element whose member equals the match, or npos() if there is none.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
             typename... _Args,
             std::enable_if_t<
-                std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable<const _Callable&, const _Type&, const _Args&...>
+                >,
                 bool
             >
-            = true
-        >
-        [[nodiscard]] typename _Mybase::const_iterator search(const _Result& match, const _Callable member, const _Args&... args) const
+            = true
+        >
+        [[nodiscard]] const_iterator search(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            const _Compare& before = this->memberOrder<_Result>(member, args...);
+            auto found = this->lowerBoundOn(match, before, member, args...);
+            if (found == this->end() || before(match, std::invoke(member, *found, args...)))
+                return this->end();
+            return found;
+        }
+
+
+        ////////////////
+        /// CONTAINS ///
+        ////////////////
+
+        /// <summary>
+        /// Checks whether any element is equal to the provided match, by binary search.
+        /// </summary>
+        /// <param name="match">The value to search for.</param>
+        /// <returns>True if such an element was found, false otherwise.</returns>
+        template <typename _MatchType>
+        [[nodiscard]] bool contains(const _MatchType& match) const
+        {
+            return this->search(match) != this->npos();
+        }
+
+        /// <summary>
+        /// Checks whether any element has a member equal to the given value, by binary search. The list must be ordered by that member,
+        /// which is compared as for search.
+        /// </summary>
+        /// <param name="match">The value to search for.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>True if such an element was found, false otherwise.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable<const _Callable&, const _Type&, const _Args&...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] bool contains(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            return this->search(match, member, args...) != this->npos();
+        }
+
+
+        ////////////////
+        /// COUNTING ///
+        ////////////////
+
+        /// <summary>
+        /// Counts the elements equal to the provided match, by binary search. O(log n).
+        /// </summary>
+        /// <param name="match">The value to count.</param>
+        /// <returns>The number of elements equal to the match.</returns>
+        template <typename _MatchType>
+        [[nodiscard]] size_t count(const _MatchType& match) const
+        {
+            auto range = std::equal_range(this->begin(), this->end(), match, this->comparer);
+            return (size_t)std::distance(range.first, range.second);
+        }
+
+        /// <summary>
+        /// Counts the elements with a member equal to the given value, by binary search. O(log n). The list must be ordered by that member,
+        /// which is compared as for search.
+        /// </summary>
+        /// <param name="match">The value to count.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>The number of elements whose member equals the match.</returns>
+        template <
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable<const _Callable&, const _Type&, const _Args&...>
+                >,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] size_t count(const _Result& match, const _Callable member, const _Args&... args) const
+        {
+            const _Compare& before = this->memberOrder<_Result>(member, args...);
+            auto first = this->lowerBoundOn(match, before, member, args...);
+            auto last = std::partition_point(first, this->end(), [&match, &before, &member, &args...](const _Type& elem) -> bool {
+                return !before(match, std::invoke(member, elem, args...));
+            });
+            return (size_t)std::distance(first, last);
+        }
+
+
+        ///////////////////////
+        /// UNIFY & DISJOIN ///
+        ///////////////////////
+
+        /// <summary>
+        /// Makes a new sorted list from the union of the elements of this list with the sorted list provided, by a single linear merge.
+        /// </summary>
+        /// <param name="rhs">The sorted list to unify with this one. Must be ordered by the same comparison.</param>
+        /// <returns>A sorted list containing one instance of every element occurring at least once in either list.</returns>
+        [[nodiscard]] sorted_list unify(const sorted_list& rhs) const
+        {
+            sorted_list result(this->comparer, this->elements.get_allocator());
+            result.elements.reserve(this->size() + rhs.size());
+            auto lhsIt = this->begin(), rhsIt = rhs.begin();
+            while (lhsIt != this->end() || rhsIt != rhs.end())
+            {
+                // Of equal elements, take this list's first
+                const bool takeLhs = (rhsIt == rhs.end() || (lhsIt != this->end() && !this->comparer(*rhsIt, *lhsIt)));
+                const _Type& next = (takeLhs ? *lhsIt : *rhsIt);
+                if (result.empty() || this->comparer(result.elements.back(), next))
+                    result.elements.push_back(next);
+                if (takeLhs)
+                    ++lhsIt;
+                else
+                    ++rhsIt;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a new sorted list from the disjoint of the elements of this list with the sorted list provided, by a single linear merge.
+        /// </summary>
+        /// <param name="rhs">The sorted list to disjoin with this one. Must be ordered by the same comparison.</param>
+        /// <returns>A sorted list containing one instance of every element occurring at least once in both lists.</returns>
+        [[nodiscard]] sorted_list disjoin(const sorted_list& rhs) const
+        {
+            sorted_list result(this->comparer, this->elements.get_allocator());
+            auto lhsIt = this->begin(), rhsIt = rhs.begin();
+            while (lhsIt != this->end() && rhsIt != rhs.end())
+            {
+                if (this->comparer(*lhsIt, *rhsIt))
+                    ++lhsIt;
+                else if (this->comparer(*rhsIt, *lhsIt))
+                    ++rhsIt;
+                else
+                {
+                    if (result.empty() || this->comparer(result.elements.back(), *lhsIt))
+                        result.elements.push_back(*lhsIt);
+                    ++lhsIt;
+                    ++rhsIt;
+                }
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Checks whether the two sorted lists share any elements, by a linear merge which stops at the first shared element.
+        /// </summary>
+        /// <param name="rhs">The other sorted list. Must be ordered by the same comparison.</param>
+        /// <returns>True if any element was contained in both, false otherwise.</returns>
+        [[nodiscard]] bool shares(const sorted_list& rhs) const
+        {
+            auto lhsIt = this->begin(), rhsIt = rhs.begin();
+            while (lhsIt != this->end() && rhsIt != rhs.end())
+            {
+                if (this->comparer(*lhsIt, *rhsIt))
+                    ++lhsIt;
+                else if (this->comparer(*rhsIt, *lhsIt))
+                    ++rhsIt;
+                else
+                    return true;
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Returns this list with all duplicates removed. Equal elements are adjacent, so this is a single linear pass.
+        /// </summary>
+        [[nodiscard]] sorted_list removeDuplicates() const
+        {
+            sorted_list result(this->comparer, this->elements.get_allocator());
+            for (const _Type& elem : this->elements)
+            {
+                if (result.empty() || this->comparer(result.elements.back(), elem))
+                    result.elements.push_back(elem);
+            }
+            return result;
+        }
+
+    private:
+        list_type elements;
+        _Compare comparer;
+
+        /// <summary>
+        /// The order of values of the given member, which is the list's own comparison: one made by list::toSorted on a member, or one
+        /// which can compare member values directly, as std::less<> and std::greater<> can.
+        /// </summary>
+        template <typename _Result, typename _Callable, typename... _Args>
+        const _Compare& memberOrder(const _Callable&, const _Args&...) const
+        {
+            using _Value = std::decay_t<std::invoke_result_t<const _Callable&, const _Type&, const _Args&...>>;
+            constexpr bool comparable = detail::is_member_order<_Compare>::value || (
+                std::is_invocable_r_v<bool, const _Compare&, const _Result&, const _Value&> &&
+                std::is_invocable_r_v<bool, const _Compare&, const _Value&, const _Result&> &&
+                !std::is_convertible_v<const _Value&, const _Type&> &&
+                !std::is_convertible_v<const _Result&, const _Type&>);
+            static_assert(comparable,
+                "easy_list::sorted_list can only search on a member its comparison can order: make it with list::toSorted on that member, "
+                "or order it by a comparison which can compare the member's values");
+            return this->comparer;
+        }
+
+        template <typename _Result, typename _Before, typename _Callable, typename... _Args>
+        const_iterator lowerBoundOn(const _Result& match, const _Before& before, const _Callable& member, const _Args&... args) const
+        {
+            return std::partition_point(this->begin(), this->end(), [&match, &before, &member, &args...](const _Type& elem) -> bool {
+                return before(std::invoke(member, elem, args...), match);
+            });
+        }
+    };
+
+    /// <summary>
+    /// A hash index over a key of the elements of a list, obtained from list::index(). Built once, in a single pass, it finds the elements
+    /// with a given key in constant time, where list::search and the like scan every element.
+    /// The index refers to the list, so must not outlive it. Lookups answer for the list as it was when the index was built or last
+    /// refreshed, and never change the index, so they may be made from several threads at once. After appending to the list, call
+    /// refresh(), which indexes the new elements on their own; after changing it in any other way (sorting, shuffling, replacing, inserting,
+    /// removing, or writing to elements in place), call rebuild(). The index only sees the list's length, so a lookup on a list grown
+    /// since is answered for the elements indexed, and one on a list shorter than when it was indexed throws std::logic_error rather
+    /// than give positions past its end.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    /// <typeparam name="_Key">The type of the keys.</typeparam>
+    /// <typeparam name="_Keyer">A callable object giving the key of an element.</typeparam>
+    template <typename _Type, typename _Alloc, typename _Key, typename _Keyer>
+    class hash_index
+    {
+        static_assert(detail::is_hashable_v<_Key>, "easy_list::hash_index needs keys which std::hash can hash");
+
+    public:
+        using list_type = list<_Type, _Alloc>;
+        using key_type = _Key;
+        using const_iterator = typename list_type::const_iterator;
+
+        hash_index(const list_type& source, const _Keyer& keyer) : source(&source), keyer(keyer), indexed(0)
+        {
+            this->rebuild();
+        }
+
+        /// <summary>
+        /// Searches return this if no element has the key.
+        /// </summary>
+        [[nodiscard]] const_iterator npos() const { return this->source->end(); }
+
+        /// <summary>
+        /// Finds the first element with the given key.
+        /// </summary>
+        /// <param name="key">The key to look up.</param>
+        /// <returns>A const iterator to the first element of the list with the key, or npos() if there is none.</returns>
+        [[nodiscard]] const_iterator search(const _Key& key) const
+        {
+            const entry* found = this->find(key);
+            return found == nullptr ? this->npos() : this->source->begin() + found->first;
+        }
+
+        /// <summary>
+        /// Checks whether any element has the given key.
+        /// </summary>
+        /// <param name="key">The key to look up.</param>
+        /// <returns>True if some element of the list has the key, false otherwise.</returns>
+        [[nodiscard]] bool contains(const _Key& key) const
+        {
+            return this->find(key) != nullptr;
+        }
+
+        /// <summary>
+        /// Counts the elements with the given key.
+        /// </summary>
+        /// <param name="key">The key to look up.</param>
+        /// <returns>The number of elements of the list with the key.</returns>
+        [[nodiscard]] size_t count(const _Key& key) const
+        {
+            const entry* found = this->find(key);
+            return found == nullptr ? 0 : found->count;
+        }
+
+        /// <summary>
+        /// Copies the elements with the given key, in the list's order, into a new list. Takes time in proportion to the number found.
+        /// </summary>
+        /// <param name="key">The key to look up.</param>
+        /// <returns>A list of all elements of the list with the key.</returns>
+        [[nodiscard]] list_type select(const _Key& key) const
+        {
+            list_type selected = list_type(this->source->get_allocator());
+            if (const entry* found = this->find(key))
+            {
+                selected.reserve(found->count);
+                for (size_t i = found->first; i != hash_index::none; i = this->next[i])
+                    selected.push_back((*this->source)[i]);
+            }
+            return selected;
+        }
+
+        /// <summary>
+        /// The number of distinct keys among the elements of the list.
+        /// </summary>
+        [[nodiscard]] size_t keys() const
+        {
+            return this->table.size();
+        }
+
+        /// <summary>
+        /// Whether the list's length has changed since the index was built or last refreshed. Changes which keep the length can't be seen.
+        /// </summary>
+        [[nodiscard]] bool stale() const noexcept
+        {
+            return this->source->size() != this->indexed;
+        }
+
+        /// <summary>
+        /// Brings the index up to date with a list which has only been appended to, adding the elements appended since the index was
+        /// built or last refreshed, in time proportional to their number. A list which has got shorter is indexed afresh.
+        /// </summary>
+        void refresh()
+        {
+            if (this->source->size() < this->indexed)
+            {
+                this->rebuild();
+                return;
+            }
+            this->indexFrom(this->indexed);
+        }
+
+        /// <summary>
+        /// Indexes the list afresh, for after it has been changed other than by appending.
+        /// </summary>
+        void rebuild()
+        {
+            this->table.clear();
+            this->next.clear();
+            this->next.reserve(this->source->size());
+            this->indexFrom(0);
+        }
+
+    private:
+        static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+        // The positions with each key are chained through next, in order, so that a key costs one table entry however many elements have it
+        struct entry
+        {
+            size_t first;
+            size_t last;
+            size_t count;
+        };
+
+        const list_type* source;
+        _Keyer keyer;
+        std::unordered_map<_Key, entry> table;
+        std::vector<size_t> next;
+        size_t indexed;
+
+        void indexFrom(const size_t from)
+        {
+            const list_type& items = *this->source;
+            for (size_t i = from; i < items.size(); i++)
+            {
+                this->next.push_back(hash_index::none);
+                const auto [slot, added] = this->table.try_emplace(std::invoke(this->keyer, items[i]), entry{ i, i, 1 });
+                if (!added)
+                {
+                    this->next[slot->second.last] = i;
+                    slot->second.last = i;
+                    slot->second.count++;
+                }
+            }
+            this->indexed = items.size();
+        }
+
+        const entry* find(const _Key& key) const
+        {
+            // Every position indexed is below the length indexed, so while the list is no shorter, each one is an element of it
+            if (this->source->size() < this->indexed)
+                throw std::logic_error("easy_list::hash_index: the list is shorter than when it was indexed, so call rebuild()");
+            const auto found = this->table.find(key);
+            return found == this->table.end() ? nullptr : &found->second;
+        }
+    };
+
+    namespace detail
+    {
+        /// <summary>
+        /// The read-only operations shared by slice_view, reverse_view, mapped_list and small_list, written once over the view's begin() and end().
+        /// Views over contiguous elements in their original order also use the vectorised search, count, min and max.
+        /// </summary>
+        /// <typeparam name="_View">The view type deriving from this.</typeparam>
+        /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+        /// <typeparam name="_Alloc">The element allocator</typeparam>
+        /// <typeparam name="_List">The type of the lists that select and sample copy elements into.</typeparam>
+        template <typename _View, typename _Type, typename _Alloc, typename _List = list<_Type, _Alloc>>
+        class view_operations
+        {
+        private:
+            const _View& self() const { return static_cast<const _View&>(*this); }
+
+            template <typename _Predicate>
+            _List selectWhere(const _Predicate& predicate) const
+            {
+                _List selected = _List(this->self().get_allocator());
+                std::copy_if(this->self().begin(), this->self().end(), std::back_inserter(selected), predicate);
+                return selected;
+            }
+
+        public:
+            /// <summary>
+            /// Search operations return this if no match was found.
+            /// </summary>
+            /// <returns>An iterator object representing "no match found".</returns>
+            [[nodiscard]] auto npos() const { return this->self().end(); }
+
+            /////////////////
+            /// SEARCHING ///
+            /////////////////
+
+            /// <summary>
+            /// Searches for an exact match.
+            /// </summary>
+            /// <typeparam name="_MatchType">A type equatable to the type of the elements of this view.</typeparam>
+            /// <param name="match">The element to search for.</param>
+            /// <returns>An iterator to the first element found equal to the provided match.</returns>
+            template <
+                typename _MatchType,
+                std::enable_if_t<
+                    template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                    bool
+                > = true
+            >
+            [[nodiscard]] auto search(const _MatchType& match) const
+            {
+                if constexpr (_View::contiguous && simd::can_match_v<_Type, _MatchType>)
+                {
+                    // If the match can't be represented as an element, nothing can equal it
+                    const _Type needle = static_cast<_Type>(match);
+                    if (!(static_cast<_MatchType>(needle) == match))
+                        return this->self().end();
+                    return this->self().begin() + simd::find(this->self().data(), this->self().size(), needle);
+                }
+                return std::find_if(
+                    this->self().begin(),
+                    this->self().end(),
+                    [&match](const _Type& other) -> bool { return other == match; }
+                );
+            }
+
+            /// <summary>
+            /// Searches for an element satisfying the given predicate.
+            /// </summary>
+            /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+            /// <param name="predicate">The predicate to check against.</param>
+            /// <returns>An iterator to the first element found to satisfy the given predicate.</returns>
+            template <
+                typename _Predicate,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                        template_helpers::is_predicate<_Predicate, _Type>
+                    >,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] auto search(const _Predicate predicate) const
+            {
+                return std::find_if(this->self().begin(), this->self().end(), predicate);
+            }
+
+            /// <summary>
+            /// Searches for an element with a member matching the given value.
+            /// </summary>
+            /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+            /// <param name="match">The value to check against.</param>
+            /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+            /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+            /// <returns>An iterator to the first element found, such that the given member variable or method returned the match provided.</returns>
+            template <
+                typename _Result,
+                typename _Callable,
+                typename... _Args,
+                std::enable_if_t<
+                    std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] auto search(const _Result& match, const _Callable member, const _Args&... args) const
+            {
+                return std::find_if(
+                    this->self().begin(),
+                    this->self().end(),
+                    [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+                );
+            }
+
+            /// <summary>
+            /// Checks whether the view contains an element equal to the provided match.
+            /// </summary>
+            template <
+                typename _MatchType,
+                std::enable_if_t<
+                    template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
+                    bool
+                > = true
+            >
+            [[nodiscard]] bool contains(const _MatchType& match) const
+            {
+                return this->search(match) != this->npos();
+            }
+
+            /// <summary>
+            /// Checks whether the view contains an element satisfying the given predicate.
+            /// </summary>
+            template <
+                typename _Predicate,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                        template_helpers::is_predicate<_Predicate, _Type>
+                    >,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] bool contains(const _Predicate predicate) const
+            {
+                return this->search(predicate) != this->npos();
+            }
+
+            /// <summary>
+            /// Checks whether the view contains an element with a member matching the given value.
+            /// </summary>
+            template <
+                typename _Result,
+                typename _Callable,
+                typename... _Args,
+                std::enable_if_t<
+                    std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] bool contains(const _Result& match, const _Callable member, const _Args&... args) const
+            {
+                return this->search(match, member, args...) != this->npos();
+            }
+
+
+            ////////////////
+            /// COUNTING ///
+            ////////////////
+
+            /// <summary>
+            /// Finds the number of elements matching the specified value.
+            /// </summary>
+            /// <typeparam name="_MatchType">A type equatable to the type of the elements of this view.</typeparam>
+            /// <param name="match">The element to search for.</param>
+            /// <returns>The number of elements matching the specified value.</returns>
+            template <
+                typename _MatchType,
+                std::enable_if_t<
+                    template_helpers::is_equatable_v<_Type, _MatchType>,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] size_t count(const _MatchType& match) const
+            {
+                if constexpr (simd::can_match_v<_Type, _MatchType>)
+                {
+                    // Counting doesn't depend on the order, so reversed views can use the kernel too
+                    const _Type needle = static_cast<_Type>(match);
+                    if (!(static_cast<_MatchType>(needle) == match))
+                        return 0;
+                    return simd::count(this->self().data(), this->self().size(), needle);
+                }
+                return std::count_if(
+                    this->self().begin(),
+                    this->self().end(),
+                    [&match](const _Type& other) -> bool { return other == match; }
+                );
+            }
+
+            /// <summary>
+            /// Finds the number of elements satisfying the given predicate.
+            /// </summary>
+            /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+            /// <param name="predicate">The predicate to check against.</param>
+            /// <returns>The number of elements satisfying the given predicate.</returns>
+            template <
+                typename _Predicate,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::negation<std::is_same<_Type, _Predicate>>,
+                        std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                        template_helpers::is_predicate<_Predicate, _Type>
+                    >,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] size_t count(const _Predicate predicate) const
+            {
+                return std::count_if(this->self().begin(), this->self().end(), [&predicate](const _Type& other) -> bool { return predicate(other); });
+            }
+
+            /// <summary>
+            /// Counts the number of elements matching the given value on the given member.
+            /// </summary>
+            /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+            /// <param name="match">The value to match.</param>
+            /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+            /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+            /// <returns>The number of elements matching the given value on the given member.</returns>
+            template <
+                typename _Result,
+                typename _Callable,
+                typename... _Args,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::is_member_pointer<_Callable>,
+                        std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] size_t count(const _Result& match, const _Callable member, const _Args&... args) const
+            {
+                return std::count_if(
+                    this->self().begin(),
+                    this->self().end(),
+                    [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+                );
+            }
+
+
+            /////////////////
+            /// SELECTING ///
+            /////////////////
+
+            /// <summary>
+            /// Copies the elements equal to the provided match, in the view's order, into a new list.
+            /// </summary>
+            /// <typeparam name="_MatchType">A type equatable to the type of the elements of this view.</typeparam>
+            /// <param name="match">The element to match.</param>
+            /// <returns>A list of all elements of this view equal to the provided match.</returns>
+            template <
+                typename _MatchType,
+                std::enable_if_t<
+                    template_helpers::is_equatable_v<_Type, _MatchType>,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] _List select(const _MatchType& match) const
+            {
+                return this->selectWhere([&match](const _Type& other) -> bool { return other == match; });
+            }
+
+            /// <summary>
+            /// Copies the elements satisfying the given predicate, in the view's order, into a new list.
+            /// </summary>
+            /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+            /// <param name="predicate">The predicate to check against.</param>
+            /// <returns>A list of all elements of this view satisfying the given predicate.</returns>
+            template <
+                typename _Predicate,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                        template_helpers::is_predicate<_Predicate, _Type>
+                    >,
+                    bool
+                >
+                = true
+            >
+            [[nodiscard]] _List select(const _Predicate predicate) const
+            {
+                return this->selectWhere([&predicate](const _Type& other) -> bool { return predicate(other); });
+            }
+
+            /// <summary>
+            /// Copies the elements matching the given value on the given member, in the view's order, into a new list.
+            /// </summary>
+            /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+            /// <param name="match">The value to match.</param>
+            /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+            /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+            /// <returns>A list of all elements of this view matching the given value on the given member.</returns>
+            template <
+                typename _Result,
+                typename _Callable,
+                typename... _Args,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::is_member_pointer<_Callable>,
+                        std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] _List select(const _Result& match, const _Callable member, const _Args&... args) const
+            {
+                return this->selectWhere([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
+            }
+
+
+            //////////////
+            /// SAMPLE ///
+            //////////////
+
+            /// <summary>
+            /// Copies a random sample of the viewed elements into a new list, each as likely to be chosen as any other, skipping over the
+            /// rest. Every call gives a different sample.
+            /// </summary>
+            /// <param name="count">The number of elements to choose. Every element is chosen if the view is no longer.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            [[nodiscard]] _List sample(const size_t count) const
+            {
+                return this->sample(count, fresh_seed());
+            }
+
+            /// <summary>
+            /// Copies a random sample of the viewed elements into a new list reproducibly: the same seed always gives the same sample.
+            /// </summary>
+            /// <param name="count">The number of elements to choose. Every element is chosen if the view is no longer.</param>
+            /// <param name="seed">The seed for the random number generator.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            [[nodiscard]] _List sample(const size_t count, const std::uint64_t seed) const
+            {
+                xoshiro256 generator(seed);
+                const auto first = this->self().begin();
+                _List sampled = _List(this->self().get_allocator());
+                for (const std::uint64_t position : sample_positions(this->self().size(), count, generator))
+                    sampled.push_back(first[(size_t)position]);
+                return sampled;
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, in a single pass.
+            /// Elements without a positive weight are never chosen.
+            /// </summary>
+            /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="weigher">The function giving the weight of each element.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+            [[nodiscard]] _List sample(const size_t count, const _Weigher weigher) const
+            {
+                xoshiro256 generator;
+                return this->sample(count, weigher, generator);
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, reproducibly: the same seed always gives the same sample
+            /// of the same elements. Elements without a positive weight are never chosen.
+            /// </summary>
+            /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="weigher">The function giving the weight of each element.</param>
+            /// <param name="seed">The seed for the random number generator.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <typename _Weigher, std::enable_if_t<detail::is_weigher_v<_Weigher, _Type>, bool> = true>
+            [[nodiscard]] _List sample(const size_t count, const _Weigher weigher, const std::uint64_t seed) const
+            {
+                xoshiro256 generator(seed);
+                return this->sample(count, weigher, generator);
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, drawing on the given random number generator.
+            /// Elements without a positive weight are never chosen.
+            /// </summary>
+            /// <typeparam name="_Weigher">A callable object, taking an element and returning its weight as a number.</typeparam>
+            /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="weigher">The function giving the weight of each element.</param>
+            /// <param name="generator">The random number generator, which is advanced.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <
+                typename _Weigher,
+                typename _Generator,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        detail::is_weigher<_Weigher, _Type>,
+                        std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] _List sample(const size_t count, const _Weigher weigher, _Generator&& generator) const
+            {
+                _List sampled = _List(this->self().get_allocator());
+                weighted_sample(this->self().begin(), this->self().size(), count, weigher, generator, [&sampled](const _Type& elem) -> void { sampled.push_back(elem); });
+                return sampled;
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, weighing each element by the
+            /// given member. Elements without a positive weight are never chosen.
+            /// </summary>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+            /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <
+                typename _Callable,
+                typename... _Args,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::is_member_pointer<_Callable>,
+                        std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type, _Args...>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] _List sample(const size_t count, const _Callable member, const _Args&... args) const
+            {
+                return this->sample(count, [&member, &args...](const _Type& elem) -> double { return (double)std::invoke(member, elem, args...); });
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, weighing each element by the given member, which takes
+            /// no arguments, reproducibly: the same seed always gives the same sample of the same elements.
+            /// </summary>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+            /// <param name="seed">The seed for the random number generator.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <
+                typename _Callable,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::is_member_pointer<_Callable>,
+                        std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] _List sample(const size_t count, const _Callable member, const std::uint64_t seed) const
+            {
+                return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, seed);
+            }
+
+            /// <summary>
+            /// Copies a weighted random sample of the viewed elements into a new list, without replacement, weighing each element by the given member, which takes
+            /// no arguments, and drawing on the given random number generator.
+            /// </summary>
+            /// <typeparam name="_Generator">A uniform random bit generator, such as xoshiro256 or std::mt19937.</typeparam>
+            /// <param name="count">The number of elements to choose.</param>
+            /// <param name="member">A reference to the member variable or method giving the weight, as applicable.</param>
+            /// <param name="generator">The random number generator, which is advanced.</param>
+            /// <returns>A new list of the chosen elements, in the view's order.</returns>
+            template <
+                typename _Callable,
+                typename _Generator,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::is_member_pointer<_Callable>,
+                        std::is_invocable_r<double, decltype(std::declval<_Callable>()), _Type>,
+                        std::bool_constant<detail::is_uniform_random_bit_generator_v<_Generator>>
+                    >, bool
+                >
+                = true
+            >
+            [[nodiscard]] _List sample(const size_t count, const _Callable member, _Generator&& generator) const
+            {
+                return this->sample(count, [&member](const _Type& elem) -> double { return (double)std::invoke(member, elem); }, generator);
+            }
+
+
+            ///////////////
+            /// MIN/MAX ///
+            ///////////////
+
+            /// <summary>
+            /// Finds the maximum under the given comparison.
+            /// </summary>
+            /// <typeparam name="_Compare">A comparison object type.</typeparam>
+            /// <param name="comparer">The comparison function.</param>
+            /// <returns>The first greatest element in the view. The view must not be empty.</returns>
+            template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+            [[nodiscard]] _Type max(const _Compare comparer) const
+            {
+                return *std::max_element(this->self().begin(), this->self().end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+            }
+
+            /// <summary>
+            /// Finds the maximum under a default comparison.
+            /// </summary>
+            /// <returns>The first greatest element in the view. The view must not be empty.</returns>
+            [[nodiscard]] _Type max() const
+            {
+                if constexpr (_View::contiguous && simd::is_orderable_v<_Type>)
+                {
+                    if (!this->self().empty())
+                        return simd::extreme<_Type, true>(this->self().data(), this->self().size());
+                }
+                return *std::max_element(this->self().begin(), this->self().end());
+            }
+
+            /// <summary>
+            /// Finds the minimum under the given comparison.
+            /// </summary>
+            /// <typeparam name="_Compare">A comparison object type.</typeparam>
+            /// <param name="comparer">The comparison function.</param>
+            /// <returns>The first least element in the view. The view must not be empty.</returns>
+            template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+            [[nodiscard]] _Type min(const _Compare comparer) const
+            {
+                return *std::min_element(this->self().begin(), this->self().end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+            }
+
+            /// <summary>
+            /// Finds the minimum under a default comparison.
+            /// </summary>
+            /// <returns>The first least element in the view. The view must not be empty.</returns>
+            [[nodiscard]] _Type min() const
+            {
+                if constexpr (_View::contiguous && simd::is_orderable_v<_Type>)
+                {
+                    if (!this->self().empty())
+                        return simd::extreme<_Type, false>(this->self().data(), this->self().size());
+                }
+                return *std::min_element(this->self().begin(), this->self().end());
+            }
+
+
+            ///////////////////
+            /// CONVERSIONS ///
+            ///////////////////
+
+            /// <summary>
+            /// Copies the viewed elements, in the view's order, into a new list.
+            /// </summary>
+            [[nodiscard]] list<_Type, _Alloc> toList() const
+            {
+                return list<_Type, _Alloc>(this->self().begin(), this->self().end(), this->self().get_allocator());
+            }
+
+            /// <summary>
+            /// Copies the viewed elements, in the view's order, into a new list.
+            /// </summary>
+            /// <param name="_Al">The allocator to build the new list with, instead of the viewed list's.</param>
+            [[nodiscard]] list<_Type, _Alloc> toList(const _Alloc& _Al) const
+            {
+                return list<_Type, _Alloc>(this->self().begin(), this->self().end(), _Al);
+            }
+        };
+    }
+
+    /// <summary>
+    /// A read-only window onto a run of elements of a list, obtained from list::sliceView(). Nothing is copied: the view refers to the
+    /// list's elements, so must not outlive the list, and is invalidated by anything which reallocates or shifts them.
+    /// Indices passed to a view may be negative, counting back from the end of the view, as for lists.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Alloc>
+    class slice_view : public detail::view_operations<slice_view<_Type, _Alloc>, _Type, _Alloc>
+    {
+    public:
+        using value_type = _Type;
+        using const_iterator = const _Type*;
+        using iterator = const_iterator;
+        static constexpr bool contiguous = true;
+
+        slice_view() : first(nullptr), extent(0), allocator() {}
+        slice_view(const _Type* first, const size_t count, const _Alloc& _Al = _Alloc()) : first(first), extent(count), allocator(_Al) {}
+
+        /// <summary>
+        /// The allocator of the viewed list, with which copies of the viewed elements are built.
+        /// </summary>
+        [[nodiscard]] _Alloc get_allocator() const { return this->allocator; }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return this->first; }
+        [[nodiscard]] const_iterator end() const noexcept { return this->first + this->extent; }
+        [[nodiscard]] const _Type* data() const noexcept { return this->first; }
+        [[nodiscard]] size_t size() const noexcept { return this->extent; }
+        [[nodiscard]] bool empty() const noexcept { return this->extent == 0; }
+        [[nodiscard]] const _Type& front() const { return this->first[0]; }
+        [[nodiscard]] const _Type& back() const { return this->first[this->extent - 1]; }
+
+        /// <summary>
+        /// The element at the given index. A negative index counts back from the end.
+        /// </summary>
+        [[nodiscard]] const _Type& operator[](const long index) const
+        {
+            return this->first[index < 0 ? (long)this->extent + index : index];
+        }
+
+        /// <summary>
+        /// Makes a narrower view, onto a sub-string of the elements of this one, by the same rules as list::slice.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this view, in which case we only go to the end of this view).</param>
+        /// <returns>A view of the slice.</returns>
+        [[nodiscard]] slice_view slice(const long start = LONG_MAX, const long length = LONG_MAX) const
+        {
+            size_t from, sliceCount;
+            detail::slice_bounds(this->extent, start, length, from, sliceCount);
+            return slice_view(this->first + from, sliceCount, this->allocator);
+        }
+
+        /// <summary>
+        /// Makes a view of the same elements in reverse order.
+        /// </summary>
+        [[nodiscard]] reverse_view<_Type, _Alloc> reverse() const
+        {
+            return reverse_view<_Type, _Alloc>(this->first, this->extent, this->allocator);
+        }
+
+    private:
+        const _Type* first;
+        size_t extent;
+        _Alloc allocator;
+    };
+
+    /// <summary>
+    /// A read-only view of a run of elements of a list, last to first, obtained from list::reverseView() or slice_view::reverse(). Nothing is copied:
+    /// the view refers to the list's elements, so must not outlive the list, and is invalidated by anything which reallocates or shifts them.
+    /// Indices passed to a view may be negative, counting back from the end of the view, as for lists.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Alloc>
+    class reverse_view : public detail::view_operations<reverse_view<_Type, _Alloc>, _Type, _Alloc>
+    {
+    public:
+        using value_type = _Type;
+        using const_iterator = std::reverse_iterator<const _Type*>;
+        using iterator = const_iterator;
+        static constexpr bool contiguous = false;
+
+        reverse_view() : first(nullptr), extent(0), allocator() {}
+
+        /// <summary>
+        /// Views the given run of elements, last to first.
+        /// </summary>
+        /// <param name="first">The first element of the run, in the list's order, which is the last in the view.</param>
+        /// <param name="count">The number of elements in the run.</param>
+        /// <param name="_Al">The allocator of the viewed list, with which copies of the viewed elements are built.</param>
+        reverse_view(const _Type* first, const size_t count, const _Alloc& _Al = _Alloc()) : first(first), extent(count), allocator(_Al) {}
+
+        /// <summary>
+        /// The allocator of the viewed list, with which copies of the viewed elements are built.
+        /// </summary>
+        [[nodiscard]] _Alloc get_allocator() const { return this->allocator; }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this->first + this->extent); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this->first); }
+        [[nodiscard]] size_t size() const noexcept { return this->extent; }
+        [[nodiscard]] bool empty() const noexcept { return this->extent == 0; }
+        [[nodiscard]] const _Type& front() const { return this->first[this->extent - 1]; }
+        [[nodiscard]] const _Type& back() const { return this->first[0]; }
+
+        /// <summary>
+        /// The viewed elements, in the list's order rather than the view's.
+        /// </summary>
+        [[nodiscard]] const _Type* data() const noexcept { return this->first; }
+
+        /// <summary>
+        /// The element at the given index in the view's order. A negative index counts back from the end.
+        /// </summary>
+        [[nodiscard]] const _Type& operator[](const long index) const
+        {
+            const long position = (index < 0 ? (long)this->extent + index : index);
+            return this->first[this->extent - 1 - position];
+        }
+
+        /// <summary>
+        /// Makes a narrower view, onto a sub-string of the elements of this one, by the same rules as list::slice. The result is still reversed.
+        /// </summary>
+        /// <param name="start">The element to start at, in the view's order.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this view, in which case we only go to the end of this view).</param>
+        /// <returns>A view of the slice.</returns>
+        [[nodiscard]] reverse_view slice(const long start = LONG_MAX, const long length = LONG_MAX) const
+        {
+            size_t from, sliceCount;
+            detail::slice_bounds(this->extent, start, length, from, sliceCount);
+            return reverse_view(this->first + (this->extent - from - sliceCount), sliceCount, this->allocator);
+        }
+
+        /// <summary>
+        /// Makes a view of the same elements in their original order.
+        /// </summary>
+        [[nodiscard]] slice_view<_Type, _Alloc> reverse() const
+        {
+            return slice_view<_Type, _Alloc>(this->first, this->extent, this->allocator);
+        }
+
+    private:
+        const _Type* first;
+        size_t extent;
+        _Alloc allocator;
+    };
+
+#ifdef EASY_LIST_MMAP
+    /// <summary>
+    /// A read-only list of trivially copyable elements, mapped straight from a file written by list::save rather than read into memory.
+    /// Opening one only checks the header, so it takes the same time however long the list is; pages are read from the file as the
+    /// elements on them are used. It has the read-only operations of a view, and slices and reversed views of it refer into the mapping,
+    /// so must not outlive it.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    template <typename _Type>
+    class mapped_list : public detail::view_operations<mapped_list<_Type>, _Type, std::allocator<_Type>>
+    {
+        static_assert(std::is_trivially_copyable_v<_Type>, "easy_list::mapped_list needs trivially copyable elements");
+
+    public:
+        using value_type = _Type;
+        using const_iterator = const _Type*;
+        using iterator = const_iterator;
+        static constexpr bool contiguous = true;
+
+        /// <summary>
+        /// Maps a list saved with list::save.
+        /// </summary>
+        /// <param name="path">The file to map.</param>
+        /// <exception cref="std::runtime_error">If the file can't be mapped, doesn't hold a list of this element type, or is cut short.</exception>
+        explicit mapped_list(const std::string& path) : mapping(nullptr), mappedBytes(0), first(nullptr), extent(0), expectedChecksum(0)
+        {
+            this->map(path);
+
+            detail::binary_header header;
+            if (sizeof(header) > this->mappedBytes)
+            {
+                this->unmap();
+                throw std::runtime_error("easy_list: saved list is cut short");
+            }
+            std::memcpy(&header, this->mapping, sizeof(header));
+            try
+            {
+                detail::check_binary_header<_Type>(header);
+                if (header.dataOffset > this->mappedBytes || header.count > (this->mappedBytes - header.dataOffset) / sizeof(_Type))
+                    throw std::runtime_error("easy_list: saved list is cut short");
+            }
+            catch (...)
+            {
+                this->unmap();
+                throw;
+            }
+
+            this->first = reinterpret_cast<const _Type*>(static_cast<const char*>(this->mapping) + header.dataOffset);
+            this->extent = (size_t)header.count;
+            this->expectedChecksum = header.checksum;
+        }
+
+        mapped_list(const mapped_list&) = delete;
+        mapped_list& operator=(const mapped_list&) = delete;
+
+        mapped_list(mapped_list&& other) noexcept
+            : mapping(other.mapping), mappedBytes(other.mappedBytes), first(other.first), extent(other.extent), expectedChecksum(other.expectedChecksum)
+        {
+            other.mapping = nullptr;
+            other.mappedBytes = 0;
+            other.first = nullptr;
+            other.extent = 0;
+        }
+
+        mapped_list& operator=(mapped_list&& other) noexcept
+        {
+            if (this != &other)
+            {
+                this->unmap();
+                std::swap(this->mapping, other.mapping);
+                std::swap(this->mappedBytes, other.mappedBytes);
+                std::swap(this->first, other.first);
+                std::swap(this->extent, other.extent);
+                std::swap(this->expectedChecksum, other.expectedChecksum);
+            }
+            return *this;
+        }
+
+        ~mapped_list() { this->unmap(); }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return this->first; }
+        [[nodiscard]] const_iterator end() const noexcept { return this->first + this->extent; }
+        [[nodiscard]] const _Type* data() const noexcept { return this->first; }
+        [[nodiscard]] size_t size() const noexcept { return this->extent; }
+        [[nodiscard]] bool empty() const noexcept { return this->extent == 0; }
+        [[nodiscard]] const _Type& front() const { return this->first[0]; }
+        [[nodiscard]] const _Type& back() const { return this->first[this->extent - 1]; }
+        [[nodiscard]] std::allocator<_Type> get_allocator() const noexcept { return std::allocator<_Type>(); }
+
+        /// <summary>
+        /// The element at the given index. A negative index counts back from the end.
+        /// </summary>
+        [[nodiscard]] const _Type& operator[](const long index) const
+        {
+            return this->first[index < 0 ? (long)this->extent + index : index];
+        }
+
+        /// <summary>
+        /// Makes a view onto a sub-string of the elements, by the same rules as list::slice. Nothing is copied.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of the list, in which case we only go to the end of the list).</param>
+        /// <returns>A view of the slice.</returns>
+        [[nodiscard]] slice_view<_Type, std::allocator<_Type>> slice(const long start = LONG_MAX, const long length = LONG_MAX) const
+        {
+            size_t from, sliceCount;
+            detail::slice_bounds(this->extent, start, length, from, sliceCount);
+            return slice_view<_Type, std::allocator<_Type>>(this->first + from, sliceCount);
+        }
+
+        /// <summary>
+        /// Makes a view of the elements in reverse order. Nothing is copied.
+        /// </summary>
+        [[nodiscard]] reverse_view<_Type, std::allocator<_Type>> reverse() const
+        {
+            return reverse_view<_Type, std::allocator<_Type>>(this->first, this->extent);
+        }
+
+        /// <summary>
+        /// Checks the elements against the checksum saved with them. This reads the whole file, which opening it doesn't.
+        /// </summary>
+        /// <returns>Whether the elements are as they were saved.</returns>
+        [[nodiscard]] bool verify() const
+        {
+            return detail::checksum(this->first, this->extent * sizeof(_Type)) == this->expectedChecksum;
+        }
+
+    private:
+        void map(const std::string& path)
+        {
+#if defined(_WIN32)
+            const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                throw std::runtime_error("easy_list: can't open " + path);
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+            {
+                CloseHandle(file);
+                throw std::runtime_error("easy_list: saved list is cut short");
+            }
+            // The view keeps the file mapped after both handles are closed
+            const HANDLE section = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const void* view = section ? MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (section)
+                CloseHandle(section);
+            CloseHandle(file);
+            if (view == nullptr)
+                throw std::runtime_error("easy_list: can't map " + path);
+            this->mapping = view;
+            this->mappedBytes = (size_t)fileSize.QuadPart;
+#else
+            const int file = ::open(path.c_str(), O_RDONLY);
+            if (file < 0)
+                throw std::runtime_error("easy_list: can't open " + path);
+            struct stat status;
+            if (::fstat(file, &status) != 0 || status.st_size == 0)
+            {
+                ::close(file);
+                throw std::runtime_error("easy_list: saved list is cut short");
+            }
+            // The mapping stays after the file is closed
+            void* view = ::mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, file, 0);
+            ::close(file);
+            if (view == MAP_FAILED)
+                throw std::runtime_error("easy_list: can't map " + path);
+            this->mapping = view;
+            this->mappedBytes = (size_t)status.st_size;
+#endif
+        }
+
+        void unmap() noexcept
+        {
+            if (this->mapping == nullptr)
+                return;
+#if defined(_WIN32)
+            UnmapViewOfFile(this->mapping);
+#else
+            ::munmap(const_cast<void*>(this->mapping), this->mappedBytes);
+#endif
+            this->mapping = nullptr;
+            this->mappedBytes = 0;
+        }
+
+        const void* mapping;
+        size_t mappedBytes;
+        const _Type* first;
+        size_t extent;
+        std::uint64_t expectedChecksum;
+    };
+#endif // EASY_LIST_MMAP
+
+    namespace detail
+    {
+        /// <summary>
+        /// An iterator over a generator whose elements are computed on demand from their index. Dereferencing builds the element.
+        /// Iterators can be moved any distance in constant time, so skipping ahead costs nothing.
+        /// </summary>
+        /// <typeparam name="_Generator">The generator type, which must have an at(std::uint64_t) method.</typeparam>
+        template <typename _Generator>
+        class generator_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = typename _Generator::value_type;
+            using difference_type = std::int64_t;
+            using pointer = void;
+            using reference = value_type;
+
+            generator_iterator() : generator(nullptr), index(0) {}
+            generator_iterator(const _Generator* generator, const std::uint64_t index) : generator(generator), index(index) {}
+
+            [[nodiscard]] value_type operator*() const { return this->generator->at(this->index); }
+            [[nodiscard]] std::uint64_t position() const { return this->index; }
+
+            generator_iterator& operator++() { this->index++; return *this; }
+            generator_iterator operator++(int) { generator_iterator old = *this; this->index++; return old; }
+            generator_iterator& operator+=(const difference_type offset) { this->index += offset; return *this; }
+            [[nodiscard]] generator_iterator operator+(const difference_type offset) const { return generator_iterator(this->generator, this->index + offset); }
+            [[nodiscard]] difference_type operator-(const generator_iterator& rhs) const { return (difference_type)(this->index - rhs.index); }
+
+            [[nodiscard]] bool operator==(const generator_iterator& rhs) const { return this->index == rhs.index; }
+            [[nodiscard]] bool operator!=(const generator_iterator& rhs) const { return this->index != rhs.index; }
+            [[nodiscard]] bool operator<(const generator_iterator& rhs) const { return this->index < rhs.index; }
+
+        private:
+            const _Generator* generator;
+            std::uint64_t index;
+        };
+
+        /// <summary>
+        /// Splits the index range [first, last) into the given number of contiguous, near-equal parts.
+        /// </summary>
+        /// <returns>The boundaries of the parts: part i is [bounds[i], bounds[i + 1]).</returns>
+        inline std::vector<std::uint64_t> split_bounds(const std::uint64_t first, const std::uint64_t last, size_t parts)
+        {
+            parts = std::max<size_t>(1, parts);
+            const std::uint64_t count = last - first;
+            std::vector<std::uint64_t> bounds;
+            bounds.reserve(parts + 1);
+            for (size_t part = 0; part <= parts; part++)
+                bounds.push_back(first + (std::uint64_t)((count / parts) * part + std::min<std::uint64_t>(count % parts, part)));
+            return bounds;
+        }
+    }
+
+    /// <summary>
+    /// The power set of a list, generated one subset at a time, obtained from list::lazyPowerSet(). Subsets are numbered, and come
+    /// in the same order as from list::powerSet(): subset i holds the distinct elements whose bits are set in i, latest first.
+    /// So the generator can be indexed, skipped through, and split into ranges to be run on different threads, without building anything else.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Alloc>
+    class power_set_generator
+    {
+    public:
+        using value_type = list<_Type, _Alloc>;
+        using iterator = detail::generator_iterator<power_set_generator>;
+        using const_iterator = iterator;
+
+        /// <summary>
+        /// Generates the power set of the distinct elements given. Throws std::length_error if there are 64 or more of them,
+        /// as the subsets could not then be numbered (nor, in practice, all visited).
+        /// </summary>
+        explicit power_set_generator(value_type distinct) : elements(std::move(distinct)), first(0), last(0)
+        {
+            if (this->elements.size() >= 64)
+                throw std::length_error("easy_list::power_set_generator: too many elements to number every subset");
+            this->last = (std::uint64_t)1 << this->elements.size();
+        }
+
+        /// <summary>
+        /// The number of subsets in this generator.
+        /// </summary>
+        [[nodiscard]] std::uint64_t size() const noexcept { return this->last - this->first; }
+        [[nodiscard]] bool empty() const noexcept { return this->first == this->last; }
+
+        [[nodiscard]] iterator begin() const { return iterator(this, this->first); }
+        [[nodiscard]] iterator end() const { return iterator(this, this->last); }
+
+        /// <summary>
+        /// Builds the subset with the given position in this generator.
+        /// </summary>
+        [[nodiscard]] value_type operator[](const std::uint64_t index) const
+        {
+            return this->at(this->first + index);
+        }
+
+        /// <summary>
+        /// Builds the subset with the given number, counting over the whole power set.
+        /// </summary>
+        [[nodiscard]] value_type at(const std::uint64_t subset) const
+        {
+            value_type result = value_type(this->allocator());
+            this->build(subset, result);
+            return result;
+        }
+
+        /// <summary>
+        /// Restricts this generator to a range of its subsets.
+        /// </summary>
+        /// <param name="from">The position of the first subset to keep.</param>
+        /// <param name="to">One past the position of the last subset to keep.</param>
+        /// <returns>A generator of just those subsets.</returns>
+        [[nodiscard]] power_set_generator range(const std::uint64_t from, const std::uint64_t to) const
+        {
+            power_set_generator result = *this;
+            result.first = this->first + std::min(from, this->size());
+            result.last = this->first + std::min(std::max(from, to), this->size());
+            return result;
+        }
+
+        /// <summary>
+        /// Splits this generator into contiguous, near-equal ranges, e.g. one per thread.
+        /// </summary>
+        /// <param name="parts">The number of ranges to split into.</param>
+        /// <returns>The ranges, in order. Together they generate exactly the subsets of this generator.</returns>
+        [[nodiscard]] std::vector<power_set_generator> split(const size_t parts) const
+        {
+            const std::vector<std::uint64_t> bounds = detail::split_bounds(this->first, this->last, parts);
+            std::vector<power_set_generator> result;
+            result.reserve(bounds.size() - 1);
+            for (size_t part = 0; part + 1 < bounds.size(); part++)
+                result.push_back(this->range(bounds[part] - this->first, bounds[part + 1] - this->first));
+            return result;
+        }
+
+        /// <summary>
+        /// Passes each subset, in order, to the given function. A single list is reused for every subset, so nothing is allocated once it has grown.
+        /// </summary>
+        /// <typeparam name="_Function">A callable object taking a const reference to a list.</typeparam>
+        /// <param name="function">The function to call on each subset.</param>
+        template <typename _Function>
+        void forEach(_Function function) const
+        {
+            value_type subset = value_type(this->allocator());
+            subset.reserve(this->elements.size());
+            for (std::uint64_t i = this->first; i < this->last; i++)
+            {
+                this->build(i, subset);
+                function(static_cast<const value_type&>(subset));
+            }
+        }
+
+        /// <summary>
+        /// Passes each subset to the given function, splitting the subsets across the shared thread pool. The function may be called from
+        /// several threads at once, so must be thread-safe, and subsets are not visited in any particular order.
+        /// </summary>
+        /// <typeparam name="_Function">A callable object taking a const reference to a list.</typeparam>
+        /// <param name="function">The function to call on each subset.</param>
+        template <typename _Function>
+        void forEachParallel(const _Function& function) const
+        {
+            const size_t count = (size_t)std::min<std::uint64_t>(this->size(), SIZE_MAX);
+            const std::vector<power_set_generator> parts = this->split(detail::parallel_chunk_count(count));
+            detail::parallel_chunks(parts.size(), parts.size(), [&parts, &function](size_t, size_t from, size_t to) -> void {
+                for (size_t part = from; part < to; part++)
+                    parts[part].forEach(function);
+            });
+        }
+
+        /// <summary>
+        /// Builds a random sample of the subsets, each as likely to be chosen as any other. Only the subsets chosen are built, and the
+        /// rest are skipped over, so sampling a few from a vast generator is quick. Every call gives a different sample.
+        /// </summary>
+        /// <param name="count">The number of subsets to choose. Every subset is chosen if the generator has no more.</param>
+        /// <returns>A list of the chosen subsets, in order.</returns>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> sample(const size_t count) const
+        {
+            return this->sample(count, detail::fresh_seed());
+        }
+
+        /// <summary>
+        /// Builds a random sample of the subsets reproducibly: the same seed always gives the same sample.
+        /// </summary>
+        /// <param name="count">The number of subsets to choose. Every subset is chosen if the generator has no more.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A list of the chosen subsets, in order.</returns>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> sample(const size_t count, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            const std::vector<std::uint64_t> positions = detail::sample_positions(this->size(), count, generator);
+            auto result = typename value_type::template rebind_list<value_type>(this->allocator());
+            result.reserve(positions.size());
+            for (const std::uint64_t position : positions)
+                result.push_back(this->at(this->first + position));
+            return result;
+        }
+
+        /// <summary>
+        /// Builds every subset into a list.
+        /// </summary>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> toList() const
+        {
+            auto result = typename value_type::template rebind_list<value_type>(this->allocator());
+            result.reserve((size_t)this->size());
+            for (std::uint64_t i = this->first; i < this->last; i++)
+                result.push_back(this->at(i));
+            return result;
+        }
+
+    private:
+        value_type elements;
+        std::uint64_t first;
+        std::uint64_t last;
+
+        _Alloc allocator() const { return this->elements.get_allocator(); }
+
+        void build(const std::uint64_t subset, value_type& result) const
+        {
+            result.clear();
+            for (size_t bit = this->elements.size(); bit-- > 0;)
+            {
+                if (subset & ((std::uint64_t)1 << bit))
+                    result.push_back(this->elements[bit]);
+            }
+        }
+    };
+
+    /// <summary>
+    /// The substrings of a list, generated one at a time, obtained from list::lazySubstrings(). Substrings are numbered, shortest first,
+    /// then by start position, so the generator can be indexed, skipped through, and split into ranges to be run on different threads.
+    /// Unlike list::substrings(), every window is generated, even if an earlier one had the same elements. The generator refers to the list,
+    /// so must not outlive it.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Alloc">The element allocator</typeparam>
+    template <typename _Type, typename _Alloc>
+    class substring_generator
+    {
+    public:
+        using value_type = list<_Type, _Alloc>;
+        using iterator = detail::generator_iterator<substring_generator>;
+        using const_iterator = iterator;
+
+        /// <summary>
+        /// Generates the substrings of the given list with lengths from minLength to maxLength inclusive. Length zero has just the one, empty, substring.
+        /// </summary>
+        substring_generator(const value_type& source, const size_t minLength, const size_t maxLength)
+            : source(&source), minLength(minLength), offsets(), first(0), last(0)
+        {
+            // offsets[i] is the number of the first substring of length minLength + i
+            std::uint64_t total = 0;
+            for (size_t length = minLength; length <= std::min(maxLength, source.size()); length++)
+            {
+                this->offsets.push_back(total);
+                total += (length == 0 ? 1 : source.size() - length + 1);
+            }
+            this->offsets.push_back(total);
+            this->last = total;
+        }
+
+        /// <summary>
+        /// The number of substrings in this generator.
+        /// </summary>
+        [[nodiscard]] std::uint64_t size() const noexcept { return this->last - this->first; }
+        [[nodiscard]] bool empty() const noexcept { return this->first == this->last; }
+
+        [[nodiscard]] iterator begin() const { return iterator(this, this->first); }
+        [[nodiscard]] iterator end() const { return iterator(this, this->last); }
+
+        /// <summary>
+        /// Builds the substring with the given position in this generator.
+        /// </summary>
+        [[nodiscard]] value_type operator[](const std::uint64_t index) const
+        {
+            return this->at(this->first + index);
+        }
+
+        /// <summary>
+        /// Builds the substring with the given number, counting over every substring of the list in the lengths generated.
+        /// </summary>
+        [[nodiscard]] value_type at(const std::uint64_t number) const
+        {
+            size_t start, length;
+            this->locate(number, start, length);
+            return value_type(this->source->begin() + start, this->source->begin() + start + length, this->allocator());
+        }
+
+        /// <summary>
+        /// Restricts this generator to a range of its substrings.
+        /// </summary>
+        /// <param name="from">The position of the first substring to keep.</param>
+        /// <param name="to">One past the position of the last substring to keep.</param>
+        /// <returns>A generator of just those substrings.</returns>
+        [[nodiscard]] substring_generator range(const std::uint64_t from, const std::uint64_t to) const
+        {
+            substring_generator result = *this;
+            result.first = this->first + std::min(from, this->size());
+            result.last = this->first + std::min(std::max(from, to), this->size());
+            return result;
+        }
+
+        /// <summary>
+        /// Splits this generator into contiguous, near-equal ranges, e.g. one per thread.
+        /// </summary>
+        /// <param name="parts">The number of ranges to split into.</param>
+        /// <returns>The ranges, in order. Together they generate exactly the substrings of this generator.</returns>
+        [[nodiscard]] std::vector<substring_generator> split(const size_t parts) const
+        {
+            const std::vector<std::uint64_t> bounds = detail::split_bounds(this->first, this->last, parts);
+            std::vector<substring_generator> result;
+            result.reserve(bounds.size() - 1);
+            for (size_t part = 0; part + 1 < bounds.size(); part++)
+                result.push_back(this->range(bounds[part] - this->first, bounds[part + 1] - this->first));
+            return result;
+        }
+
+        /// <summary>
+        /// Passes each substring, in order, to the given function. A single list is reused for every substring, so nothing is allocated once it has grown.
+        /// </summary>
+        /// <typeparam name="_Function">A callable object taking a const reference to a list.</typeparam>
+        /// <param name="function">The function to call on each substring.</param>
+        template <typename _Function>
+        void forEach(_Function function) const
+        {
+            value_type substring = value_type(this->allocator());
+            for (std::uint64_t i = this->first; i < this->last; i++)
+            {
+                size_t start, length;
+                this->locate(i, start, length);
+                substring.assign(this->source->begin() + start, this->source->begin() + start + length);
+                function(static_cast<const value_type&>(substring));
+            }
+        }
+
+        /// <summary>
+        /// Passes each substring to the given function, splitting the substrings across the shared thread pool. The function may be called from
+        /// several threads at once, so must be thread-safe, and substrings are not visited in any particular order.
+        /// </summary>
+        /// <typeparam name="_Function">A callable object taking a const reference to a list.</typeparam>
+        /// <param name="function">The function to call on each substring.</param>
+        template <typename _Function>
+        void forEachParallel(const _Function& function) const
+        {
+            const std::vector<substring_generator> parts = this->split(detail::parallel_chunk_count((size_t)this->size()));
+            detail::parallel_chunks(parts.size(), parts.size(), [&parts, &function](size_t, size_t from, size_t to) -> void {
+                for (size_t part = from; part < to; part++)
+                    parts[part].forEach(function);
+            });
+        }
+
+        /// <summary>
+        /// Builds a random sample of the substrings, each as likely to be chosen as any other. Only the substrings chosen are built, and the
+        /// rest are skipped over, so sampling a few from a vast generator is quick. Every call gives a different sample.
+        /// </summary>
+        /// <param name="count">The number of substrings to choose. Every substring is chosen if the generator has no more.</param>
+        /// <returns>A list of the chosen substrings, in order.</returns>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> sample(const size_t count) const
+        {
+            return this->sample(count, detail::fresh_seed());
+        }
+
+        /// <summary>
+        /// Builds a random sample of the substrings reproducibly: the same seed always gives the same sample.
+        /// </summary>
+        /// <param name="count">The number of substrings to choose. Every substring is chosen if the generator has no more.</param>
+        /// <param name="seed">The seed for the random number generator.</param>
+        /// <returns>A list of the chosen substrings, in order.</returns>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> sample(const size_t count, const std::uint64_t seed) const
+        {
+            xoshiro256 generator(seed);
+            const std::vector<std::uint64_t> positions = detail::sample_positions(this->size(), count, generator);
+            auto result = typename value_type::template rebind_list<value_type>(this->allocator());
+            result.reserve(positions.size());
+            for (const std::uint64_t position : positions)
+                result.push_back(this->at(this->first + position));
+            return result;
+        }
+
+        /// <summary>
+        /// Builds every substring into a list.
+        /// </summary>
+        [[nodiscard]] typename value_type::template rebind_list<value_type> toList() const
+        {
+            auto result = typename value_type::template rebind_list<value_type>(this->allocator());
+            result.reserve((size_t)this->size());
+            for (std::uint64_t i = this->first; i < this->last; i++)
+                result.push_back(this->at(i));
+            return result;
+        }
+
+    private:
+        const value_type* source;
+        size_t minLength;
+        std::vector<std::uint64_t> offsets;
+        std::uint64_t first;
+        std::uint64_t last;
+
+        _Alloc allocator() const { return this->source->get_allocator(); }
+
+        void locate(const std::uint64_t number, size_t& start, size_t& length) const
+        {
+            const size_t step = (size_t)(std::upper_bound(this->offsets.begin(), this->offsets.end(), number) - this->offsets.begin()) - 1;
+            length = this->minLength + step;
+            start = (size_t)(number - this->offsets[step]);
+        }
+    };
+
+    /// <summary>
+    /// A list with room for a few elements inside itself, which only allocates once it grows beyond them. The buffer belongs to the
+    /// small_list, not to its allocator, which is only used for storage past the buffer, so any allocator can be used with it.
+    /// Moving a small_list hands its storage over if it has spilled out of the buffer, and otherwise moves the elements one by one,
+    /// so pointers and iterators into a small_list are invalidated by moving or swapping it, unlike with a list.
+    /// The read-only operations of views (search, count, contains, min, max, select, sample, toList) work on it, and select and sample give small lists.
+    /// It also has list's sorting, removing, replacing, unify, disjoin and concatenation, each with its in-place form where list has one;
+    /// the radix sorts, parallel operations and pipelines are list's alone.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    /// <typeparam name="_Capacity">The number of elements held without allocating</typeparam>
+    /// <typeparam name="_Alloc">The element allocator, used once the list outgrows its buffer</typeparam>
+    template <typename _Type, size_t _Capacity = 16, typename _Alloc = std::allocator<_Type>>
+    class small_list : public detail::view_operations<small_list<_Type, _Capacity, _Alloc>, _Type, _Alloc, small_list<_Type, _Capacity, _Alloc>>
+    {
+        static_assert(_Capacity > 0, "easy_list::small_list needs room for at least one element");
+        static_assert(std::is_same_v<typename std::allocator_traits<_Alloc>::value_type, _Type>, "easy_list::small_list needs an allocator of its element type");
+
+        using _Traits = std::allocator_traits<_Alloc>;
+
+    public:
+        using value_type = _Type;
+        using allocator_type = _Alloc;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = _Type&;
+        using const_reference = const _Type&;
+        using pointer = _Type*;
+        using const_pointer = const _Type*;
+        using iterator = _Type*;
+        using const_iterator = const _Type*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        static constexpr bool contiguous = true;
+        static constexpr size_t inline_capacity = _Capacity;
+
+        template <typename _Other>
+        using rebind_list = small_list<_Other, _Capacity, typename _Traits::template rebind_alloc<_Other>>;
+
+        ////////////////////
+        /// CONSTRUCTORS ///
+        ////////////////////
+
+        small_list() noexcept(noexcept(_Alloc())) : first(this->buffered()), extent(0), room(_Capacity), allocator() {}
+
+        explicit small_list(const _Alloc& _Al) noexcept : first(this->buffered()), extent(0), room(_Capacity), allocator(_Al) {}
+
+        small_list(const size_t _Count, const _Type& _Val, const _Alloc& _Al = _Alloc()) : small_list(_Al)
+        {
+            this->filling([&]() { this->resize(_Count, _Val); });
+        }
+
+        template <class _Iter, std::enable_if_t<detail::is_iterator_v<_Iter>, bool> = true>
+        small_list(_Iter _First, _Iter _Last, const _Alloc& _Al = _Alloc()) : small_list(_Al)
+        {
+            this->filling([&]() { this->append(_First, _Last); });
+        }
+
+        small_list(std::initializer_list<_Type> _Ilist, const _Alloc& _Al = _Alloc()) : small_list(_Ilist.begin(), _Ilist.end(), _Al) {}
+
+        small_list(const small_list& _Right) : small_list(_Right, _Traits::select_on_container_copy_construction(_Right.allocator)) {}
+
+        small_list(const small_list& _Right, const _Alloc& _Al) : small_list(_Right.begin(), _Right.end(), _Al) {}
+
+        small_list(small_list&& _Right) noexcept(std::is_nothrow_move_constructible_v<_Type>) : small_list(_Right.allocator)
+        {
+            this->takeFrom(_Right);
+        }
+
+        small_list(small_list&& _Right, const _Alloc& _Al) : small_list(_Al)
+        {
+            this->filling([&]() { this->takeFrom(_Right); });
+        }
+
+        ~small_list() { this->release(); }
+
+
+        //////////////////////////
+        /// OPERATOR OVERLOADS ///
+        //////////////////////////
+
+        small_list& operator=(const small_list& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+            if constexpr (_Traits::propagate_on_container_copy_assignment::value)
+            {
+                // Storage from this list's allocator has to go back to it before the allocator is replaced
+                if (this->allocator != rhs.allocator)
+                    this->release();
+                this->allocator = rhs.allocator;
+            }
+            this->clear();
+            this->append(rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        small_list& operator=(small_list&& rhs) noexcept(
+            std::is_nothrow_move_constructible_v<_Type> &&
+            (_Traits::propagate_on_container_move_assignment::value || _Traits::is_always_equal::value))
+        {
+            if (this == &rhs)
+                return *this;
+            this->release();
+            if constexpr (_Traits::propagate_on_container_move_assignment::value)
+                this->allocator = rhs.allocator;
+            this->takeFrom(rhs);
+            return *this;
+        }
+
+        small_list& operator=(std::initializer_list<_Type> rhs)
+        {
+            this->clear();
+            this->append(rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        [[nodiscard]] _Type& operator[](const size_t index) noexcept { return this->first[index]; }
+        [[nodiscard]] const _Type& operator[](const size_t index) const noexcept { return this->first[index]; }
+
+        [[nodiscard]] friend bool operator==(const small_list& lhs, const small_list& rhs)
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        [[nodiscard]] friend bool operator!=(const small_list& lhs, const small_list& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /// <summary>
+        /// Concatenates two small lists.
+        /// </summary>
+        /// <param name="rhs">The other list to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        [[nodiscard]] small_list operator+(const small_list& rhs) const&
+        {
+            small_list result = *this;
+            result.append(rhs.begin(), rhs.end());
+            return result;
+        }
+
+        /// <summary>
+        /// Concatenates a temporary small list with another, appending to the temporary's storage.
+        /// </summary>
+        /// <param name="rhs">The other list to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        [[nodiscard]] small_list operator+(const small_list& rhs) &&
+        {
+            *this += rhs;
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Concatenates this list with a single item.
+        /// </summary>
+        /// <param name="rhs">The item to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        [[nodiscard]] small_list operator+(const _Type& rhs) const&
+        {
+            small_list result = *this;
+            result.push_back(rhs);
+            return result;
+        }
+
+        /// <summary>
+        /// Concatenates a temporary small list with a single item, appending to the temporary's storage.
+        /// </summary>
+        /// <param name="rhs">The item to concatenate.</param>
+        /// <returns>The concatenated list.</returns>
+        [[nodiscard]] small_list operator+(const _Type& rhs) &&
+        {
+            this->push_back(rhs);
+            return std::move(*this);
+        }
+
+        /// <summary>
+        /// Appends (concatenates) another small list on the end of this one.
+        /// </summary>
+        /// <param name="rhs">The list to append.</param>
+        /// <returns>This list, after the append operation.</returns>
+        small_list& operator+=(const small_list& rhs)
         {
-            return std::find_if(
-                this->begin(),
-                this->end(),
-                [match, member, args...](const _Type& other)
-                -> bool { return std::invoke(member, other, args...) == match; }
-            );
+            if (this == &rhs)
+            {
+                // Appending a list to itself would read elements as they move
+                const small_list copy = rhs;
+                return *this += copy;
+            }
+            this->append(rhs.begin(), rhs.end());
+            return *this;
+        }
+
+        /// <summary>
+        /// Appends (concatenates) a single item on the end of this list.
+        /// </summary>
+        /// <param name="rhs">The item to append.</param>
+        /// <returns>This list, after the append operation.</returns>
+        small_list& operator+=(const _Type& rhs)
+        {
+            this->push_back(rhs);
+            return *this;
+        }
+
+
+        //////////////
+        /// ACCESS ///
+        //////////////
+
+        [[nodiscard]] iterator begin() noexcept { return this->first; }
+        [[nodiscard]] iterator end() noexcept { return this->first + this->extent; }
+        [[nodiscard]] const_iterator begin() const noexcept { return this->first; }
+        [[nodiscard]] const_iterator end() const noexcept { return this->first + this->extent; }
+        [[nodiscard]] const_iterator cbegin() const noexcept { return this->first; }
+        [[nodiscard]] const_iterator cend() const noexcept { return this->first + this->extent; }
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+
+        [[nodiscard]] _Type* data() noexcept { return this->first; }
+        [[nodiscard]] const _Type* data() const noexcept { return this->first; }
+        [[nodiscard]] size_t size() const noexcept { return this->extent; }
+        [[nodiscard]] bool empty() const noexcept { return this->extent == 0; }
+        [[nodiscard]] size_t capacity() const noexcept { return this->room; }
+        [[nodiscard]] size_t max_size() const noexcept { return _Traits::max_size(this->allocator); }
+        [[nodiscard]] _Alloc get_allocator() const noexcept { return this->allocator; }
+
+        [[nodiscard]] _Type& front() { return this->first[0]; }
+        [[nodiscard]] const _Type& front() const { return this->first[0]; }
+        [[nodiscard]] _Type& back() { return this->first[this->extent - 1]; }
+        [[nodiscard]] const _Type& back() const { return this->first[this->extent - 1]; }
+
+        /// <summary>
+        /// The element at the given index, checking that there is one.
+        /// </summary>
+        [[nodiscard]] _Type& at(const size_t index)
+        {
+            if (index >= this->extent)
+                throw std::out_of_range("easy_list::small_list index out of range");
+            return this->first[index];
+        }
+
+        /// <summary>
+        /// The element at the given index, checking that there is one.
+        /// </summary>
+        [[nodiscard]] const _Type& at(const size_t index) const
+        {
+            if (index >= this->extent)
+                throw std::out_of_range("easy_list::small_list index out of range");
+            return this->first[index];
         }
 
+        /// <summary>
+        /// Whether the elements are in the buffer inside this list, rather than in storage from the allocator.
+        /// </summary>
+        [[nodiscard]] bool isInline() const noexcept { return this->first == this->buffered(); }
+
 
         ////////////////
-        /// CONTAINS ///
+        /// CHANGING ///
         ////////////////
 
         /// <summary>
-        /// Checks whether the given element is contained in the list.
+        /// Constructs an element on the end of the list. The arguments may refer to elements of the list, even if it has to grow.
         /// </summary>
-        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to search for.</param>
-        /// <returns>True if a match was found, false otherwise.</returns>
-        template <
-            typename _MatchType,
-            std::enable_if_t<
-                template_helpers::is_equatable_v<const _Type&, const _MatchType&>,
-                bool
-            >
-            = true
-        >
-        [[nodiscard]] bool contains(const _MatchType& match) const
+        /// <returns>The new element.</returns>
+        template <typename... _Args>
+        _Type& emplace_back(_Args&&... args)
         {
-            return this->search(match) != this->npos();
+            if (this->extent < this->room)
+            {
+                _Traits::construct(this->allocator, this->first + this->extent, std::forward<_Args>(args)...);
+                return this->first[this->extent++];
+            }
+
+            // The new element is made before the old ones move, in case it's made from one of them
+            const size_t newRoom = this->grown(this->extent + 1);
+            _Type* storage = _Traits::allocate(this->allocator, newRoom);
+            try
+            {
+                _Traits::construct(this->allocator, storage + this->extent, std::forward<_Args>(args)...);
+                try
+                {
+                    this->transferTo(storage);
+                }
+                catch (...)
+                {
+                    _Traits::destroy(this->allocator, storage + this->extent);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                _Traits::deallocate(this->allocator, storage, newRoom);
+                throw;
+            }
+            this->adopt(storage, newRoom);
+            return this->first[this->extent++];
+        }
+
+        void push_back(const _Type& elem) { this->emplace_back(elem); }
+        void push_back(_Type&& elem) { this->emplace_back(std::move(elem)); }
+
+        void pop_back()
+        {
+            _Traits::destroy(this->allocator, this->first + --this->extent);
         }
 
         /// <summary>
-        /// Checks whether any element in the list satisfies the given predicate.
+        /// Constructs an element before the given position, shifting the elements after it along.
         /// </summary>
-        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
-        /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>True if any element satisfies the given predicate, false otherwise.</returns>
+        /// <returns>An iterator to the new element.</returns>
+        template <typename... _Args>
+        iterator emplace(const const_iterator position, _Args&&... args)
+        {
+            const size_t index = (size_t)(position - this->first);
+            this->emplace_back(std::forward<_Args>(args)...);
+            std::rotate(this->first + index, this->first + this->extent - 1, this->first + this->extent);
+            return this->first + index;
+        }
+
+        iterator insert(const const_iterator position, const _Type& elem) { return this->emplace(position, elem); }
+        iterator insert(const const_iterator position, _Type&& elem) { return this->emplace(position, std::move(elem)); }
+
+        /// <summary>
+        /// Inserts copies of a range of elements before the given position.
+        /// </summary>
+        /// <returns>An iterator to the first element inserted.</returns>
+        template <class _Iter, std::enable_if_t<detail::is_iterator_v<_Iter>, bool> = true>
+        iterator insert(const const_iterator position, _Iter _First, _Iter _Last)
+        {
+            const size_t index = (size_t)(position - this->first);
+            const size_t before = this->extent;
+            this->append(_First, _Last);
+            std::rotate(this->first + index, this->first + before, this->first + this->extent);
+            return this->first + index;
+        }
+
+        iterator insert(const const_iterator position, std::initializer_list<_Type> elems)
+        {
+            return this->insert(position, elems.begin(), elems.end());
+        }
+
+        /// <summary>
+        /// Removes the element at the given position, shifting the elements after it back.
+        /// </summary>
+        /// <returns>An iterator to the element after the one removed.</returns>
+        iterator erase(const const_iterator position)
+        {
+            return this->erase(position, position + 1);
+        }
+
+        /// <summary>
+        /// Removes the elements in the given range, shifting the elements after it back.
+        /// </summary>
+        /// <returns>An iterator to the element after those removed.</returns>
+        iterator erase(const const_iterator from, const const_iterator to)
+        {
+            _Type* target = this->first + (from - this->first);
+            _Type* kept = std::move(this->first + (to - this->first), this->end(), target);
+            this->destroyFrom(kept);
+            return target;
+        }
+
+        void clear() noexcept { this->destroyFrom(this->first); }
+
+        /// <summary>
+        /// Makes room for at least the given number of elements, so that the list can grow to that size without allocating again.
+        /// </summary>
+        void reserve(const size_t wanted)
+        {
+            if (wanted > this->room)
+                this->reallocate(wanted);
+        }
+
+        /// <summary>
+        /// Gives back any storage beyond what the elements need, moving them back into the list's own buffer if they fit.
+        /// </summary>
+        void shrink_to_fit()
+        {
+            if (this->isInline() || this->extent == this->room)
+                return;
+            if (this->extent <= _Capacity)
+            {
+                this->transferTo(this->buffered());
+                this->adopt(this->buffered(), _Capacity);
+                return;
+            }
+            this->reallocate(this->extent);
+        }
+
+        void resize(const size_t wanted)
+        {
+            if (wanted <= this->extent)
+            {
+                this->destroyFrom(this->first + wanted);
+                return;
+            }
+            this->reserve(wanted);
+            while (this->extent < wanted)
+                this->emplace_back();
+        }
+
+        void resize(const size_t wanted, const _Type& fill)
+        {
+            if (wanted <= this->extent)
+            {
+                this->destroyFrom(this->first + wanted);
+                return;
+            }
+            if (wanted > this->room)
+            {
+                // The fill value may be one of the elements, which are about to move
+                const _Type copy = fill;
+                this->reserve(wanted);
+                while (this->extent < wanted)
+                    this->emplace_back(copy);
+                return;
+            }
+            while (this->extent < wanted)
+                this->emplace_back(fill);
+        }
+
+        /// <summary>
+        /// Exchanges the elements of this list with those of another. Elements in either list's buffer are moved across.
+        /// </summary>
+        /// <param name="other">The list to swap with.</param>
+        void swap(small_list& other)
+        {
+            small_list temp = std::move(other);
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        friend void swap(small_list& lhs, small_list& rhs) { lhs.swap(rhs); }
+
+        /// <summary>
+        /// Sorts the list with the given comparison.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        small_list& sort(const _Compare comparer)
+        {
+            std::sort(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison.
+        /// </summary>
+        /// <returns>This list, after having been sorted.</returns>
+        small_list& sort()
+        {
+            return this->sort(std::less<>{});
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison on a specified member.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
         template <
-            typename _Predicate,
+            typename _Compare,
+            typename _Callable,
+            typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
             std::enable_if_t<
                 std::conjunction_v<
-                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
-                    template_helpers::is_predicate<_Predicate, _Type>
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
                 >,
                 bool
             >
             = true
         >
-        [[nodiscard]] bool contains(const _Predicate predicate) const
+        small_list& sort(const _Compare comparer, const _Callable member, const _Args&... args)
         {
-            return this->search(predicate) != this->npos();
+            return this->sortOn<false, _Result>(comparer, member, args...);
         }
 
         /// <summary>
-        /// Checks whether any element in the list has the given member returning a match to the given value.
+        /// Sorts the list with the default comparison on a specified member.
         /// </summary>
-        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
-        /// <param name="match">The value to check against.</param>
-        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>True if any element in the list returned the given value on the given member, false otherwise.</returns>
+        /// <returns>This list, after having been sorted.</returns>
         template <
-            typename _Result,
+            typename _Callable,
+            typename... _Args
+        >
+        small_list& sort(const _Callable member, const _Args&... args)
+        {
+            return this->sort(std::less<>{}, member, args...);
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison, keeping equal elements in their original order.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
+        small_list& stableSort(const _Compare comparer)
+        {
+            std::stable_sort(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list with the default comparison, keeping equal elements in their original order.
+        /// </summary>
+        /// <returns>This list, after having been sorted.</returns>
+        small_list& stableSort()
+        {
+            return this->stableSort(std::less<>{});
+        }
+
+        /// <summary>
+        /// Sorts the list with the given comparison on a specified member, keeping elements with equal members in their original order.
+        /// </summary>
+        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
+        /// <param name="comparer">The comparison to sort by.</param>
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Compare,
             typename _Callable,
             typename... _Args,
+            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
             std::enable_if_t<
-                std::is_invocable_r_v<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>,
+                std::conjunction_v<
+                    template_helpers::is_comparison<_Compare, _Result>,
+                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                >,
                 bool
             >
             = true
         >
-        [[nodiscard]] bool contains(const _Result& match, const _Callable member, const _Args&... args) const
+        small_list& stableSort(const _Compare comparer, const _Callable member, const _Args&... args)
         {
-            return this->search(match, member, args...) != this->npos();
+            return this->sortOn<true, _Result>(comparer, member, args...);
         }
 
-
-        ///////////////////////
-        /// UNIFY & DISJOIN ///
-        ///////////////////////
-
         /// <summary>
-        /// Makes a new list from the union of the elements of this list with the list or vector provided.
+        /// Sorts the list with the default comparison on a specified member, keeping elements with equal members in their original order.
         /// </summary>
-        /// <param name="rhs">The list or vector to unify with this one.</param>
-        /// <returns>A list containing one instance of every element occurring at least once in either list, in the order in which they first occur in the right-hand side, followed by the order in which they first occur in this list.</returns>
-        [[nodiscard]] list unify(const _Mybase rhs) const
+        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after having been sorted.</returns>
+        template <
+            typename _Callable,
+            typename... _Args
+        >
+        small_list& stableSort(const _Callable member, const _Args&... args)
         {
-            list<_Type, _Alloc> result = list<_Type, _Alloc>();
-            for (_Type elem : *this + rhs)
-            {
-                if (!result.contains(elem))
-                    result.push_back(elem);
-            }
-            return result;
+            return this->stableSort(std::less<>{}, member, args...);
         }
 
         /// <summary>
-        /// Makes a new list from the disjoint of the elements of this list with the list or vector provided.
+        /// Makes a new list of a sub-string of the elements of this one, by the same rules as list::slice.
         /// </summary>
-        /// <param name="rhs">The list or vector to disjoin with this one.</param>
-        /// <returns>A list containing one instance of every element occurring at least once in both lists, in the order in which they first occur in the right-hand side.</returns>
-        [[nodiscard]] list disjoin(const _Mybase rhs) const
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>The slice.</returns>
+        [[nodiscard]] small_list slice(const long start = LONG_MAX, const long length = LONG_MAX) const
         {
-            list<_Type, _Alloc> result = list<_Type, _Alloc>();
-            for (_Type elem : rhs)
-            {
-                if (!result.contains(elem) && this->contains(elem))
-                    result.push_back(elem);
-            }
-            return result;
+            size_t from, sliceCount;
+            detail::slice_bounds(this->extent, start, length, from, sliceCount);
+            return small_list(this->first + from, this->first + from + sliceCount, _Traits::select_on_container_copy_construction(this->allocator));
         }
 
         /// <summary>
-        /// Returns this list with all duplicates removed.
+        /// Makes a new list of the elements of this one, last to first.
         /// </summary>
-        [[nodiscard]] list removeDuplicates() const
+        [[nodiscard]] small_list reverse() const
         {
-            return this->disjoin(*this);
+            return small_list(this->rbegin(), this->rend(), _Traits::select_on_container_copy_construction(this->allocator));
         }
 
         /// <summary>
-        /// Checks whether the two lists share any elements.
+        /// Makes a new list based on this list, converting each element to a new element by use of the given transformer.
         /// </summary>
-        /// <param name="rhs">The other list or vector.</param>
-        /// <returns>True if any element was contained in both, false otherwise.</returns>
-        bool shares(const _Mybase rhs) const
+        /// <typeparam name="_Result">The elements of the result of the transformation.</typeparam>
+        /// <typeparam name="_Transformer">A callable object type, which takes elements of this list as arguments and returns elements of the result of the transformation.</typeparam>
+        /// <param name="transformer">The transformation to apply to each element in this current list.</param>
+        /// <param name="...args">The arguments to supply to the transformer, if applicable.</param>
+        /// <returns>The result of the transformation, with the same inline capacity.</returns>
+        template <
+            typename _Result,
+            typename _Transformer,
+            typename... _Args,
+            std::enable_if_t<std::is_invocable_r_v<_Result, decltype(std::declval<_Transformer>()), _Type, _Args...>, bool> = true
+        >
+        [[nodiscard]] rebind_list<_Result> transform(const _Transformer transformer, const _Args&... args) const
         {
-            return this->disjoin(rhs).size() > 0;
+            rebind_list<_Result> result = rebind_list<_Result>(typename rebind_list<_Result>::allocator_type(this->allocator));
+            result.reserve(this->extent);
+            for (const _Type& elem : *this)
+                result.push_back(std::invoke(transformer, elem, args...));
+            return result;
         }
 
-
-        ///////////////
-        /// SORTING ///
-        ///////////////
+        /// <summary>
+        /// Makes a new list from the union of the elements of this list with the list provided, by the same rules as list::unify.
+        /// </summary>
+        /// <param name="rhs">The list to unify with this one.</param>
+        /// <returns>A list containing one instance of every element occurring at least once in either list, in the order in which they first occur in this list, followed by the right-hand side.</returns>
+        [[nodiscard]] small_list unify(const small_list& rhs) const
+        {
+            std::vector<const _Type*> seq;
+            seq.reserve(this->extent + rhs.extent);
+            for (const _Type& elem : *this)
+                seq.push_back(&elem);
+            for (const _Type& elem : rhs)
+                seq.push_back(&elem);
+            detail::unique_first_occurrences(seq);
+            return this->fromPointers(seq);
+        }
 
         /// <summary>
-        /// Sorts the list with the given comparison.
+        /// Makes a new list from the disjoint of the elements of this list with the list provided, by the same rules as list::disjoin.
         /// </summary>
-        /// <typeparam name="_Compare">A comparison object type.</typeparam>
-        /// <param name="comparer">The comparison to sort by.</param>
-        /// <returns>This list, after having been sorted.</returns>
-        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
-        list& sort(const _Compare comparer)
+        /// <param name="rhs">The list to disjoin with this one.</param>
+        /// <returns>A list containing one instance of every element occurring at least once in both lists, in the order in which they first occur in the right-hand side.</returns>
+        [[nodiscard]] small_list disjoin(const small_list& rhs) const
         {
-            std::sort(
-                this->begin(),
-                this->end(),
-                template_helpers::cast_static_comparison<_Compare, _Type>(comparer)
-            );
-            return *this;
+            std::vector<const _Type*> seq;
+            seq.reserve(rhs.extent);
+            for (const _Type& elem : rhs)
+                seq.push_back(&elem);
+            detail::unique_first_occurrences(seq);
+            detail::keep_occurring_in(seq, this->begin(), this->end());
+            return this->fromPointers(seq);
         }
 
         /// <summary>
-        /// Sorts the list with the default comparison.
+        /// Selects a sub-list containing all elements of this list not equal to the provided match.
         /// </summary>
-        /// <returns>This list, after having been sorted.</returns>
-        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
-        list& sort()
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to remove.</param>
+        /// <returns>A sub-list containing all elements of this list not equal to the provided match.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        [[nodiscard]] small_list removeAll(const _MatchType& match) const
         {
-            this->sort(std::less<>{});
-            return *this;
+            return this->select([&match](const _Type& other) -> bool { return !(other == match); });
         }
 
         /// <summary>
-        /// Sorts the list with the given comparison on a specified member.
+        /// Selects a sub-list containing all elements of this list failing the given predicate.
         /// </summary>
-        /// <typeparam name="_Compare">A comparison object type on the type of the specified member variable or the return type of the member method, as applicable.</typeparam>
-        /// <param name="comparer">The comparison to sort by.</param>
-        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
-        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>This list, after having been sorted.</returns>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>A sub-list containing all elements of this list failing the given predicate.</returns>
         template <
-            typename _Compare,
-            typename _Callable,
-            typename... _Args,
-            typename _Result = std::remove_reference_t<decltype(std::invoke(std::declval<_Callable>(), std::declval<_Type>(), std::declval<_Args>()...))>,
+            typename _Predicate,
             std::enable_if_t<
                 std::conjunction_v<
-                    template_helpers::is_comparison<_Compare, _Result>,
-                    template_helpers::is_const_member_of<_Callable, _Type, _Args...>
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
                 >,
                 bool
             >
             = true
         >
-        list& sort(const _Compare comparer, const _Callable member, const _Args&... args)
+        [[nodiscard]] small_list removeAll(const _Predicate predicate) const
         {
-            inline auto static_comparer = template_helpers::cast_static_comparison<_Compare, _Type>(comparer);
-            auto pred = [static_comparer, member, args...](const _Type& lhs, const _Type& rhs) -> auto {
-                const _Result resultLhs = std::invoke(member, lhs, args...);
-                const _Result resultRhs = std::invoke(member, rhs, args...);
-                return static_comparer(resultLhs, resultRhs);
-            };
-            std::sort(this->begin(), this->end(), pred);
-            return *this;
+            return this->select([&predicate](const _Type& other) -> bool { return !predicate(other); });
         }
 
         /// <summary>
-        /// Sorts the list with the default comparison on a specified member.
+        /// Selects a sub-list containing all elements of this list where the given member doesn't equal the provided match.
         /// </summary>
-        /// <param name="member">A reference to the member variable or method to sort on, as applicable.</param>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to (not) match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>This list, after having been sorted.</returns>
+        /// <returns>A sub-list containing all elements of this list where the given member doesn't equal the provided match.</returns>
         template <
+            typename _Result,
             typename _Callable,
-            typename... _Args
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
         >
-        list& sort(const _Callable member, const _Args&... args)
+        [[nodiscard]] small_list removeAll(const _Result& match, const _Callable member, const _Args&... args) const
         {
-            this->sort(std::less<>{}, member, args...);
-            return *this;
+            return this->select([&match, &member, &args...](const _Type& other) -> bool { return !(std::invoke(member, other, args...) == match); });
         }
 
-
-        /////////////////
-        /// SELECTING ///
-        /////////////////
-
         /// <summary>
-        /// Selects a sub-list containing all elements of this list equal to the provided match.
+        /// Removes the first match and returns the result.
         /// </summary>
         /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to search for.</param>
-        /// <returns>A sub-list containing all elements of this list equal to the provided match.</returns>
+        /// <param name="match">The element to remove.</param>
+        /// <returns>A sub-list of this with the first occurrence of the match removed.</returns>
         template <
             typename _MatchType,
             std::enable_if_t<
@@ -507,23 +9902,17 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list select(const _MatchType& match) const
+        [[nodiscard]] small_list removeFirst(const _MatchType& match) const
         {
-            list sublist = list();
-            for (_Type elem : *this)
-            {
-                if (elem == match)
-                    sublist.push_back(elem);
-            }
-            return sublist;
+            return this->without(this->search(match));
         }
 
         /// <summary>
-        /// Selects a sub-list containing all elements of this list equal to the provided match.
+        /// Removes the first element found satisfying the given predicate and returns the result.
         /// </summary>
         /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
         /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>A sub-list containing all elements of this list satisfying the given predicate.</returns>
+        /// <returns>A sub-list of this with the first element satisfying the predicate removed.</returns>
         template <
             typename _Predicate,
             std::enable_if_t<
@@ -535,25 +9924,19 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list select(const _Predicate predicate) const
+        [[nodiscard]] small_list removeFirst(const _Predicate predicate) const
         {
-            list sublist = list();
-            for (_Type elem : *this)
-            {
-                if (predicate(elem))
-                    sublist.push_back(elem);
-            }
-            return sublist;
+            return this->without(this->search(predicate));
         }
 
         /// <summary>
-        /// Selects a sub-list containing all elements of this list where the given member equals the provided match
+        /// Removes the first element found whose specified members equals the specified match, and returns the result.
         /// </summary>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
         /// <param name="match">The value to match.</param>
         /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>A sub-list containing all elements of this list where the given member equals the provided match.</returns>
+        /// <returns>A sub-list of this with the first element where the given member equals the given match removed.</returns>
         template <
             typename _Result,
             typename _Callable,
@@ -566,55 +9949,19 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list select(const _Result& match, const _Callable member, const _Args&... args) const
-        {
-            list sublist = list();
-            for (_Type elem : *this)
-            {
-                if (std::invoke(member, elem, args...) == match)
-                    sublist.push_back(elem);
-            }
-            return sublist;
-        }
-
-
-        ////////////////
-        /// REMOVING ///
-        ////////////////
-
-        /// <summary>
-        /// Removes the element at the given index (if any element exists there) and returns the result.
-        /// </summary>
-        /// <param name="index">The index to remove at.</param>
-        /// <returns>The result of the remove operation.</returns>
-        [[nodiscard]] list removeAt(const long index) const
+        [[nodiscard]] small_list removeFirst(const _Result& match, const _Callable member, const _Args&... args) const
         {
-            if (index < 0)
-            {
-                long newIndex = this->size() + index;
-                if (newIndex < 0)
-                    return *this;
-                return this->removeAt(newIndex);
-            }
-            return this->slice(0, index) + this->slice(index + 1);
+            return this->without(this->search(match, member, args...));
         }
 
-        /// <summary>
-        /// Removes the element at the given iterator (if any element exists there) and returns the result.
-        /// </summary>
-        /// <param name="index">The index to remove at.</param>
-        /// <returns>The result of the remove operation.</returns>
-        [[nodiscard]] list removeAt(const typename _Mybase::const_iterator iter) const
-        {
-            return this->removeAt(std::distance(this->begin(), iter));
-        }
+        /// In place ///
 
         /// <summary>
-        /// Selects a sub-list containing all elements of this list not equal to the provided match.
+        /// Removes from this list every element not equal to the provided match, without allocating.
         /// </summary>
         /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to remove.</param>
-        /// <returns>A sub-list containing all elements of this list not equal to the provided match.</returns>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the selection.</returns>
         template <
             typename _MatchType,
             std::enable_if_t<
@@ -623,58 +9970,83 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list removeAll(const _MatchType& match) const
+        small_list& selectInPlace(const _MatchType& match)
         {
-            return this->select([match](_Type other) -> bool { return other != match; });
+            return this->removeWhere([&match](const _Type& other) -> bool { return !(other == match); });
         }
 
         /// <summary>
-        /// Removes the first match and returns the result.
+        /// Removes from this list every element failing the given predicate, without allocating.
         /// </summary>
-        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to remove.</param>
-        /// <returns>A sub-list of this with the first occurrence of the match removed.</returns>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the selection.</returns>
         template <
-            typename _MatchType,
+            typename _Predicate,
             std::enable_if_t<
-                template_helpers::is_equatable_v<_Type, _MatchType>,
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
                 bool
             >
             = true
         >
-            [[nodiscard]] list removeFirst(const _MatchType& match) const
+        small_list& selectInPlace(const _Predicate predicate)
         {
-            return this->removeAt(this->search(match));
+            return this->removeWhere([&predicate](const _Type& other) -> bool { return !predicate(other); });
         }
 
         /// <summary>
-        /// Selects a sub-list containing all elements of this list failing the given predicate.
+        /// Removes from this list every element where the given member doesn't equal the provided match, without allocating.
         /// </summary>
-        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
-        /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>A sub-list containing all elements of this list failing the given predicate.</returns>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the selection.</returns>
         template <
-            typename _Predicate,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
             std::enable_if_t<
                 std::conjunction_v<
-                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
-                    template_helpers::is_predicate<_Predicate, _Type>
-                >,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            >
+            = true
+        >
+        small_list& selectInPlace(const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->removeWhere([&match, &member, &args...](const _Type& other) -> bool { return !(std::invoke(member, other, args...) == match); });
+        }
+
+        /// <summary>
+        /// Removes from this list every element equal to the provided match, without allocating.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
                 bool
             >
             = true
         >
-        [[nodiscard]] list removeAll(const _Predicate predicate) const
+        small_list& removeAllInPlace(const _MatchType& match)
         {
-            return this->select([predicate](_Type other) -> bool { return !predicate(other); });
+            return this->removeWhere([&match](const _Type& other) -> bool { return other == match; });
         }
 
         /// <summary>
-        /// Removes the first element found satisfying the given predicate and returns the result.
+        /// Removes from this list every element satisfying the given predicate, without allocating.
         /// </summary>
         /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
         /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>A sub-list of this with the first element satisfying the predicate removed.</returns>
+        /// <returns>This list, after the removal.</returns>
         template <
             typename _Predicate,
             std::enable_if_t<
@@ -686,19 +10058,19 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list removeFirst(const _Predicate predicate) const
+        small_list& removeAllInPlace(const _Predicate predicate)
         {
-            return this->removeAt(this->search(predicate));
+            return this->removeWhere([&predicate](const _Type& other) -> bool { return predicate(other); });
         }
 
         /// <summary>
-        /// Selects a sub-list containing all elements of this list where the given member doesn't equal the provided match
+        /// Removes from this list every element where the given member equals the provided match, without allocating.
         /// </summary>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
-        /// <param name="match">The value to (not) match.</param>
+        /// <param name="match">The value to match.</param>
         /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>A sub-list containing all elements of this list where the given member doesn't equal the provided match.</returns>
+        /// <returns>This list, after the removal.</returns>
         template <
             typename _Result,
             typename _Callable,
@@ -711,19 +10083,60 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list removeAll(const _Result& match, const _Callable member, const _Args&... args) const
+        small_list& removeAllInPlace(const _Result& match, const _Callable member, const _Args&... args)
         {
-            return this->select([match, member, args...](_Type other) -> bool { return std::invoke(member, other, args...) != match; });
+            return this->removeWhere([&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; });
         }
 
         /// <summary>
-        /// Removes the first element found whose specified members equals the specified match, and returns the result.
+        /// Removes from this list the first element equal to the provided match, if any.
+        /// </summary>
+        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
+        /// <param name="match">The element to search for.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _MatchType,
+            std::enable_if_t<
+                template_helpers::is_equatable_v<_Type, _MatchType>,
+                bool
+            >
+            = true
+        >
+        small_list& removeFirstInPlace(const _MatchType& match)
+        {
+            return this->eraseFound(this->search(match));
+        }
+
+        /// <summary>
+        /// Removes from this list the first element satisfying the given predicate, if any.
+        /// </summary>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>This list, after the removal.</returns>
+        template <
+            typename _Predicate,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
+                >,
+                bool
+            >
+            = true
+        >
+        small_list& removeFirstInPlace(const _Predicate predicate)
+        {
+            return this->eraseFound(this->search(predicate));
+        }
+
+        /// <summary>
+        /// Removes from this list the first element where the given member equals the provided match, if any.
         /// </summary>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
         /// <param name="match">The value to match.</param>
         /// <param name="member">A reference to the member variable or method to check, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>A sub-list of this with the first element where the given member equals the given match removed.</returns>
+        /// <returns>This list, after the removal.</returns>
         template <
             typename _Result,
             typename _Callable,
@@ -736,178 +10149,190 @@ namespace easy_list
             >
             = true
         >
-        [[nodiscard]] list removeFirst(const _Result& match, const _Callable member, const _Args&... args) const
+        small_list& removeFirstInPlace(const _Result& match, const _Callable member, const _Args&... args)
         {
-            return this->removeAt(this->search(match, member, args...));
+            return this->eraseFound(this->search(match, member, args...));
         }
 
-
-        ////////////////
-        /// COUNTING ///
-        ////////////////
-
         /// <summary>
-        /// Finds the number of elements matching the specified value.
+        /// Makes a new list from this one by replacing each match found with the given replacement value.
         /// </summary>
-        /// <typeparam name="_MatchType">A type equatable to the type of the elements of this list.</typeparam>
-        /// <param name="match">The element to search for.</param>
-        /// <returns>The number of elements matching the specified value.</returns>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
         template <
+            typename _Replacer,
             typename _MatchType,
             std::enable_if_t<
                 std::conjunction_v<
-                    std::negation<std::is_same<_Type, _MatchType>>,
+                    std::is_convertible<_Replacer, _Type>,
                     template_helpers::is_equatable<_Type, _MatchType>
                 >,
                 bool
-            >
-            = true
+            > = true
         >
-        [[nodiscard]] size_t count(const _MatchType& match) const
+        [[nodiscard]] small_list replace(const _Replacer& replacement, const _MatchType& match) const
         {
-            return this->select(match).size();
+            small_list result = *this;
+            result.replaceInPlace(replacement, match);
+            return result;
         }
 
         /// <summary>
-        /// Counts the number of elements satisfying the given predicate.
+        /// Makes a new list from this one by replacing each element satisfying the given predicate with the given replacement value.
         /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
         /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
         /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>The number of elements satisfying the given predicate.</returns>
+        /// <returns>The result of the replacement.</returns>
         template <
+            typename _Replacer,
             typename _Predicate,
             std::enable_if_t<
                 std::conjunction_v<
-                    std::negation<std::is_same<_Type, _Predicate>>,
+                    std::is_convertible<_Replacer, _Type>,
                     std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
                     template_helpers::is_predicate<_Predicate, _Type>
                 >,
                 bool
-            >
-            = true
+            > = true
         >
-        [[nodiscard]] size_t count(const _Predicate predicate) const
+        [[nodiscard]] small_list replace(const _Replacer& replacement, const _Predicate predicate) const
         {
-            return this->select(predicate).size();
+            small_list result = *this;
+            result.replaceInPlace(replacement, predicate);
+            return result;
         }
 
         /// <summary>
-        /// Counts the number of elements matching the given value on the given member.
+        /// Makes a new list from this one by replacing each element matching the specified value on the specified member with the specified value.
         /// </summary>
+        /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="replacement">The value with which to replace the matched elements.</param>
         /// <param name="match">The value to match.</param>
         /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>The number of elements matching the given value on the given member.</returns>
+        /// <returns>The result of the replacement.</returns>
         template <
+            typename _Replacer,
             typename _Result,
             typename _Callable,
             typename... _Args,
             std::enable_if_t<
                 std::conjunction_v<
+                    std::is_convertible<_Replacer, _Type>,
                     std::is_member_pointer<_Callable>,
                     std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
                 >, bool
-            >
-            = true
+            > = true
         >
-        [[nodiscard]] size_t count(const _Result& match, const _Callable member, const _Args&... args) const
+        [[nodiscard]] small_list replace(const _Replacer& replacement, const _Result& match, const _Callable member, const _Args&... args) const
         {
-            return this->select(match, member, args...).size();
+            small_list result = *this;
+            result.replaceInPlace(replacement, match, member, args...);
+            return result;
         }
 
-
-        ////////////////////
-        /// TRANSFORMING ///
-        ////////////////////
-
         /// <summary>
-        /// Makes a new list based on this list, converting each element into the given type.
+        /// Makes a new list from this one by transforming each match found.
         /// </summary>
-        /// <typeparam name="_ConvertibleType">A type to which the elements of this list are convertible.</typeparam>
-        /// <returns>The result of the transformation.</returns>
-        template<class _ConvertibleType, std::enable_if_t<std::is_convertible_v<_Type, _ConvertibleType>, bool> = true>
-        [[nodiscard]] list<_ConvertibleType> transform()
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <returns>The result of the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _MatchType,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    template_helpers::is_equatable<_Type, _MatchType>
+                >,
+                bool
+            > = true
+        >
+        [[nodiscard]] small_list replace(const _Transformer transformer, const _MatchType& match) const
         {
-            auto result = list<_ConvertibleType>();
-            for (_Type elem : *this)
-                result.push_back(static_cast<_ConvertibleType>(elem));
+            small_list result = *this;
+            result.replaceInPlace(transformer, match);
             return result;
         }
 
         /// <summary>
-        /// Makes a new list based on this list, converting each element to a new element by use of the given transformer.
+        /// Makes a new list from this one by transforming each element satisfying the given predicate.
         /// </summary>
-        /// <typeparam name="_Result">The elements of the result of the transformation.</typeparam>
-        /// <typeparam name="_Transformer">A callable object type, which takes elements of this list as arguments and returns elements of the result of the transformation.</typeparam>
-        /// <param name="transformer">The transformation to apply to each element in this current list.</param>
-        /// <param name="...args">The arguments to supply to the transformer, if applicable.</param>
-        /// <returns>The result of the transformation.</returns>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="predicate">The predicate to check against.</param>
+        /// <returns>The result of the replacement.</returns>
         template <
-            typename _Result,
             typename _Transformer,
-            typename... _Args,
+            typename _Predicate,
             std::enable_if_t<
                 std::conjunction_v<
-                    std::negation<std::is_member_pointer<_Transformer>>,
-                    std::is_invocable_r<_Result, decltype(std::declval<_Transformer>()), _Type, _Args...>
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::negation<template_helpers::is_equatable<_Type, _Predicate>>,
+                    template_helpers::is_predicate<_Predicate, _Type>
                 >,
                 bool
-            >
-            = true
+            > = true
         >
-        [[nodiscard]] list<_Result> transform(const _Transformer transformer, const _Args&... args) const
+        [[nodiscard]] small_list replace(const _Transformer transformer, const _Predicate predicate) const
         {
-            list<_Result> result = list<_Result>();
-            for (_Type elem : *this)
-                result.push_back(transformer(elem, args...));
+            small_list result = *this;
+            result.replaceInPlace(transformer, predicate);
             return result;
         }
 
         /// <summary>
-        /// Makes a new list based on this list, converting each element into one of its members.
+        /// Makes a new list from this one by transforming each element matching the specified value on the specified member.
         /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
-        /// <param name="member">A reference to the member variable or method to transform to, as applicable.</param>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>The result of the transformation.</returns>
+        /// <returns>The result of the replacement.</returns>
         template <
+            typename _Transformer,
             typename _Result,
             typename _Callable,
             typename... _Args,
             std::enable_if_t<
                 std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
                     std::is_member_pointer<_Callable>,
-                   std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
-                >,
-                bool
-            >
-            = true
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
         >
-        [[nodiscard]] list<_Result> transform(const _Callable member, const _Args&... args) const
+        [[nodiscard]] small_list replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) const
         {
-            static auto transformer = [member](const _Type& obj, const _Args&... args)->_Result {
-                return std::invoke(member, obj, args...);
-            };
-            list<_Result> result = list<_Result>();
-            for (_Type elem : *this)
-                result.push_back(transformer(elem, args...));
+            small_list result = *this;
+            result.replaceInPlace(transformer, match, member, args...);
             return result;
         }
 
-
-        ///////////////
-        /// REPLACE ///
-        ///////////////
+        /// In place ///
 
         /// <summary>
-        /// Makes a new list from this one by replacing each match found with the given replacement value.
+        /// Replaces, in this list, each match found with the given replacement value.
         /// </summary>
         /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
         /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
         /// <param name="replacement">The value with which to replace the matched elements.</param>
         /// <param name="match">The value to match.</param>
-        /// <returns>The result of the replacement.</returns>
+        /// <returns>This list, after the replacement.</returns>
         template <
             typename _Replacer,
             typename _MatchType,
@@ -919,27 +10344,20 @@ namespace easy_list
                 bool
             > = true
         >
-        [[nodiscard]] list replace(_Replacer replacement, const _MatchType& match) const
+        small_list& replaceInPlace(const _Replacer& replacement, const _MatchType& match)
         {
-            list result = list();
-            for (_Type elem : *this)
-            {
-                if (elem == match)
-                    result.push_back(replacement);
-                else
-                    result.push_back(elem);
-            }
-            return result;
+            std::replace_if(this->begin(), this->end(), [&match](const _Type& other) -> bool { return other == match; }, static_cast<_Type>(replacement));
+            return *this;
         }
 
         /// <summary>
-        /// Makes a new list from this one by replacing each element satisfying the given predicate with the given replacement value.
+        /// Replaces, in this list, each element satisfying the given predicate with the given replacement value.
         /// </summary>
         /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
         /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
         /// <param name="replacement">The value with which to replace the matched elements.</param>
         /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>The result of the replacement.</returns>
+        /// <returns>This list, after the replacement.</returns>
         template <
             typename _Replacer,
             typename _Predicate,
@@ -952,21 +10370,14 @@ namespace easy_list
                 bool
             > = true
         >
-        [[nodiscard]] list replace(_Replacer replacement, const _Predicate predicate) const
+        small_list& replaceInPlace(const _Replacer& replacement, const _Predicate predicate)
         {
-            list result = list();
-            for (_Type elem : *this)
-            {
-                if (predicate(elem))
-                    result.push_back(replacement);
-                else
-                    result.push_back(elem);
-            }
-            return result;
+            std::replace_if(this->begin(), this->end(), [&predicate](const _Type& other) -> bool { return predicate(other); }, static_cast<_Type>(replacement));
+            return *this;
         }
 
         /// <summary>
-        /// Makes a new list from this one by replacing each element matching the specified value on the specified member with the specified value.
+        /// Replaces, in this list, each element matching the specified value on the specified member with the specified value.
         /// </summary>
         /// <typeparam name="_Replacer">A type convertible to the elements of this list.</typeparam>
         /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
@@ -974,7 +10385,7 @@ namespace easy_list
         /// <param name="match">The value to match.</param>
         /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
         /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>The result of the replacement.</returns>
+        /// <returns>This list, after the replacement.</returns>
         template <
             typename _Replacer,
             typename _Result,
@@ -988,29 +10399,25 @@ namespace easy_list
                 >, bool
             > = true
         >
-        [[nodiscard]] list replace(_Replacer replacement, const _Result& match, const _Callable member, const _Args&... args) const
+        small_list& replaceInPlace(const _Replacer& replacement, const _Result& match, const _Callable member, const _Args&... args)
         {
-            list result = list();
-            for (_Type elem : *this)
-            {
-                if (std::invoke(member, elem, args...) == match)
-                    result.push_back(replacement);
-                else
-                    result.push_back(elem);
-            }
-            return result;
+            std::replace_if(
+                this->begin(),
+                this->end(),
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; },
+                static_cast<_Type>(replacement)
+            );
+            return *this;
         }
 
-        /// With transformer ///
-
         /// <summary>
-        /// Makes a new list from this one by transforming each match found.
+        /// Transforms, in this list, each match found.
         /// </summary>
         /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
         /// <typeparam name="_MatchType">A type equatable to elements of this list.</typeparam>
         /// <param name="transformer">The transformation to apply to each matched element.</param>
         /// <param name="match">The value to match.</param>
-        /// <returns>The result of the replacement.</returns>
+        /// <returns>This list, after the replacement.</returns>
         template <
             typename _Transformer,
             typename _MatchType,
@@ -1023,27 +10430,19 @@ namespace easy_list
                 bool
             > = true
         >
-        [[nodiscard]] list replace(const _Transformer transformer, const _MatchType& match) const
+        small_list& replaceInPlace(const _Transformer transformer, const _MatchType& match)
         {
-            list result = list();
-            for (_Type elem : *this)
-            {
-                if (elem == match)
-                    result.push_back(std::invoke(transformer, elem));
-                else
-                    result.push_back(elem);
-            }
-            return result;
+            return this->transformWhere(transformer, [&match](const _Type& other) -> bool { return other == match; });
         }
 
         /// <summary>
-        /// Makes a new list from this one by transforming each element satisfying the given predicate.
+        /// Transforms, in this list, each element satisfying the given predicate.
         /// </summary>
         /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
         /// <typeparam name="_Predicate">A callable object, taking a element type as an argument and returning a bool.</typeparam>
         /// <param name="transformer">The transformation to apply to each matched element.</param>
         /// <param name="predicate">The predicate to check against.</param>
-        /// <returns>The result of the replacement.</returns>
+        /// <returns>This list, after the replacement.</returns>
         template <
             typename _Transformer,
             typename _Predicate,
@@ -1057,249 +10456,728 @@ namespace easy_list
                 bool
             > = true
         >
-        [[nodiscard]] list replace(const _Transformer transformer, const _Predicate predicate) const
+        small_list& replaceInPlace(const _Transformer transformer, const _Predicate predicate)
         {
-            list result = list();
-            for (_Type elem : *this)
+            return this->transformWhere(transformer, predicate);
+        }
+
+        /// <summary>
+        /// Transforms, in this list, each element matching the specified value on the specified member.
+        /// </summary>
+        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
+        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
+        /// <param name="transformer">The transformation to apply to each matched element.</param>
+        /// <param name="match">The value to match.</param>
+        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
+        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
+        /// <returns>This list, after the replacement.</returns>
+        template <
+            typename _Transformer,
+            typename _Result,
+            typename _Callable,
+            typename... _Args,
+            std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_convertible<_Transformer, _Type>>,
+                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
+                    std::is_member_pointer<_Callable>,
+                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
+                >, bool
+            > = true
+        >
+        small_list& replaceInPlace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args)
+        {
+            return this->transformWhere(
+                transformer,
+                [&match, &member, &args...](const _Type& other) -> bool { return std::invoke(member, other, args...) == match; }
+            );
+        }
+
+        /// <summary>
+        /// Makes a read-only view onto a sub-string of elements of this list, without copying them, by the same rules as list::sliceView.
+        /// </summary>
+        /// <param name="start">The element to start at.</param>
+        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
+        /// <returns>A view of the slice.</returns>
+        [[nodiscard]] slice_view<_Type, _Alloc> sliceView(const long start = LONG_MAX, const long length = LONG_MAX) const
+        {
+            size_t from, sliceCount;
+            detail::slice_bounds(this->extent, start, length, from, sliceCount);
+            return slice_view<_Type, _Alloc>(this->first + from, sliceCount, this->allocator);
+        }
+
+        /// <summary>
+        /// Makes a read-only view of the elements of this list, last to first, without copying them.
+        /// </summary>
+        [[nodiscard]] reverse_view<_Type, _Alloc> reverseView() const
+        {
+            return reverse_view<_Type, _Alloc>(this->first, this->extent, this->allocator);
+        }
+
+    private:
+        _Type* first;
+        size_t extent;
+        size_t room;
+        _Alloc allocator;
+        alignas(_Type) unsigned char buffer[sizeof(_Type) * _Capacity];
+
+        _Type* buffered() noexcept { return reinterpret_cast<_Type*>(this->buffer); }
+        const _Type* buffered() const noexcept { return reinterpret_cast<const _Type*>(this->buffer); }
+
+        size_t grown(const size_t wanted) const noexcept { return std::max(wanted, this->room * 2); }
+
+        /// <summary>
+        /// Makes a small list, with this one's allocator, of copies of the pointed-to elements.
+        /// </summary>
+        small_list fromPointers(const std::vector<const _Type*>& elems) const
+        {
+            small_list result = small_list(_Traits::select_on_container_copy_construction(this->allocator));
+            result.reserve(elems.size());
+            for (const _Type* elem : elems)
+                result.push_back(*elem);
+            return result;
+        }
+
+        /// <summary>
+        /// Makes a copy of this list without the element at the given position, or a plain copy if the position is the end.
+        /// </summary>
+        small_list without(const const_iterator found) const
+        {
+            if (found == this->end())
+                return *this;
+            small_list result = small_list(_Traits::select_on_container_copy_construction(this->allocator));
+            result.reserve(this->extent - 1);
+            result.append(this->begin(), found);
+            result.append(found + 1, this->end());
+            return result;
+        }
+
+        template <typename _Predicate>
+        small_list& removeWhere(const _Predicate& predicate)
+        {
+            this->erase(std::remove_if(this->begin(), this->end(), predicate), this->end());
+            return *this;
+        }
+
+        small_list& eraseFound(const const_iterator found)
+        {
+            if (found != this->end())
+                this->erase(found);
+            return *this;
+        }
+
+        template <typename _Transformer, typename _Predicate>
+        small_list& transformWhere(const _Transformer& transformer, const _Predicate& predicate)
+        {
+            for (_Type& elem : *this)
+            {
+                if (predicate(elem))
+                    elem = std::invoke(transformer, elem);
+            }
+            return *this;
+        }
+
+        /// <summary>
+        /// Sorts the list on a specified member, reading the member of both elements on each comparison.
+        /// </summary>
+        template <bool _Stable, typename _Result, typename _Compare, typename _Callable, typename... _Args>
+        small_list& sortOn(const _Compare& comparer, const _Callable& member, const _Args&... args)
+        {
+            auto static_comparer = template_helpers::cast_static_comparison<_Compare, _Result>(comparer);
+            auto pred = [&static_comparer, &member, &args...](const _Type& lhs, const _Type& rhs) -> bool {
+                const _Result resultLhs = std::invoke(member, lhs, args...);
+                const _Result resultRhs = std::invoke(member, rhs, args...);
+                return static_comparer(resultLhs, resultRhs);
+            };
+            if constexpr (_Stable)
+                std::stable_sort(this->begin(), this->end(), pred);
+            else
+                std::sort(this->begin(), this->end(), pred);
+            return *this;
+        }
+
+        template <class _Iter>
+        void append(_Iter _First, _Iter _Last)
+        {
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<_Iter>::iterator_category>)
+                this->reserve(this->extent + (size_t)std::distance(_First, _Last));
+            for (; _First != _Last; ++_First)
+                this->emplace_back(*_First);
+        }
+
+        /// <summary>
+        /// Runs part of a constructor which may throw, giving back whatever it had taken if it does, as the destructor won't run.
+        /// </summary>
+        template <typename _Fill>
+        void filling(const _Fill& fill)
+        {
+            try
+            {
+                fill();
+            }
+            catch (...)
             {
-                if (predicate(elem))
-                    result.push_back(std::invoke(transformer, elem));
-                else
-                    result.push_back(elem);
+                this->release();
+                throw;
             }
-            return result;
         }
 
         /// <summary>
-        /// Makes a new list from this one by transforming each element matching the specified value on the specified member.
+        /// Constructs the elements afresh in the given storage, moving them if that can't throw and copying them otherwise,
+        /// so that if one throws, the elements already made are destroyed and this list is left as it was.
         /// </summary>
-        /// <typeparam name="_Transformer">A callable object, taking elements of this list as its sole argument and returning another object of the same type.</typeparam>
-        /// <typeparam name="_Result">The type of the member variable, or return type of the member method, as applicable.</typeparam>
-        /// <param name="transformer">The transformation to apply to each matched element.</param>
-        /// <param name="match">The value to match.</param>
-        /// <param name="member">A reference to the member variable or method to match on, as applicable.</param>
-        /// <param name="...args">The arguments to pass to the member method, if applicable.</param>
-        /// <returns>The result of the replacement.</returns>
-        template <
-            typename _Transformer,
-            typename _Result,
-            typename _Callable,
-            typename... _Args,
-            std::enable_if_t<
-                std::conjunction_v<
-                    std::negation<std::is_convertible<_Transformer, _Type>>,
-                    std::is_invocable_r<_Type, decltype(std::declval<_Transformer>()), _Type>,
-                    std::is_member_pointer<_Callable>,
-                    std::is_invocable_r<_Result, decltype(std::declval<_Callable>()), _Type, _Args...>
-                >, bool
-            > = true
-        >
-        [[nodiscard]] list replace(const _Transformer transformer, const _Result& match, const _Callable member, const _Args&... args) const
+        void transferTo(_Type* storage)
         {
-            list result = list();
-            for (_Type elem : *this)
+            size_t made = 0;
+            try
             {
-                if (std::invoke(member, elem, args...) == match)
-                    result.push_back(std::invoke(transformer, elem));
-                else
-                    result.push_back(elem);
+                for (; made < this->extent; made++)
+                    _Traits::construct(this->allocator, storage + made, std::move_if_noexcept(this->first[made]));
+            }
+            catch (...)
+            {
+                for (size_t i = 0; i < made; i++)
+                    _Traits::destroy(this->allocator, storage + i);
+                throw;
             }
-            return result;
         }
 
-        /////////////
-        /// SLICE ///
-        /////////////
-
         /// <summary>
-        /// Makes a new list from a sub-string of elements of this one.
+        /// Moves the elements to new storage from the allocator, with room for the given number of them.
         /// </summary>
-        /// <param name="start">The element to start at.</param>
-        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
-        /// <returns>The result of the slice.</returns>
-        list slice(const long start = LONG_MAX, const long length = LONG_MAX) const
+        void reallocate(const size_t newRoom)
         {
-            if (start < 0)
+            _Type* storage = _Traits::allocate(this->allocator, newRoom);
+            try
             {
-                long newStart = this->size() + start;
-                if (newStart < 0)
-                    return this->slice(0, length);
-                return this->slice(newStart, length);
+                this->transferTo(storage);
             }
-
-            if (length < 0)
+            catch (...)
             {
-                long newLength = this->size() + length - start;
-                if (newLength < 0)
-                    return this->slice(0, 0);
-                return this->slice(start, newLength);
+                _Traits::deallocate(this->allocator, storage, newRoom);
+                throw;
             }
+            this->adopt(storage, newRoom);
+        }
 
-
-            if (start >= this->size())
-                return list();
-            list result = list();
-            size_t actualLength = (length > this->size() - start ? this->size() - start : length);
-            result.reserve(actualLength);
-            for (size_t i = 0; i < actualLength; i++)
-                result.push_back((*this)[start + i]);
-            return result;
+        /// <summary>
+        /// Switches to storage that the elements have just been transferred to, destroying the old elements and giving back their storage.
+        /// </summary>
+        void adopt(_Type* storage, const size_t newRoom) noexcept
+        {
+            const size_t kept = this->extent;
+            this->release();
+            this->first = storage;
+            this->extent = kept;
+            this->room = newRoom;
         }
 
         /// <summary>
-        /// Assigns to this list a sub-list formed of a sub-string of elements of the current list.
+        /// Takes the elements of another list, which is left empty, into this one, which must be empty and inline. Storage from the allocator
+        /// changes hands if the allocators are equal, and otherwise the elements are moved one by one, as are those in the other list's buffer.
         /// </summary>
-        /// <param name="start">The element to start at.</param>
-        /// <param name="length">The length of the string (unless it goes beyond the end of this list, in which case we only go to the end of this list).</param>
-        /// <returns>This list after splicing.</returns>
-        list& splice(const size_t start, const long length = LONG_MAX)
+        void takeFrom(small_list& other)
         {
-            if (length < 0)
+            if (!other.isInline() && this->allocator == other.allocator)
             {
-                long newLength = this->size() + length;
-                if (newLength < 0)
-                    return this->splice(start, 0);
-                return this->splice(start, newLength);
+                this->first = other.first;
+                this->extent = other.extent;
+                this->room = other.room;
+                other.first = other.buffered();
+                other.extent = 0;
+                other.room = _Capacity;
+                return;
             }
-            *this = this->slice(start, length);
-            return *this;
+            this->reserve(other.extent);
+            for (_Type& elem : other)
+                this->emplace_back(std::move(elem));
+            other.release();
+        }
+
+        void destroyFrom(_Type* from) noexcept
+        {
+            for (_Type* elem = from; elem != this->first + this->extent; elem++)
+                _Traits::destroy(this->allocator, elem);
+            this->extent = (size_t)(from - this->first);
         }
 
         /// <summary>
-        /// Returns a list of all unique substrings of this list of the given length.
+        /// Destroys the elements and gives back any storage taken from the allocator, leaving the list empty and inline.
         /// </summary>
-        list<list> substrings(const size_t length) const
+        void release() noexcept
         {
-            if (length < 0)
+            this->clear();
+            if (!this->isInline())
+                _Traits::deallocate(this->allocator, this->first, this->room);
+            this->first = this->buffered();
+            this->room = _Capacity;
+        }
+    };
+
+    /// <summary>
+    /// Counts of what operations on lists cost, for finding where a load test spends its budget. Use counted_list<T> in place of
+    /// list<T>, and wrap predicates and projections with count_calls, then read the counts with snapshot(), measure() or scope.
+    /// Counting is only done when EASY_LIST_INSTRUMENT is defined. Otherwise counted_list<T> is plain list<T>, count_calls
+    /// returns its argument unchanged, and the counts are always zero, so instrumented code costs nothing in a normal build.
+    /// Counts are kept per thread.
+    /// </summary>
+    namespace instrumentation
+    {
+        /// <summary>
+        /// The costs counted.
+        /// </summary>
+        struct counters
+        {
+            size_t copies = 0;          // Elements copy-constructed or copy-assigned
+            size_t moves = 0;           // Elements move-constructed or move-assigned
+            size_t allocations = 0;     // Calls to allocate storage
+            size_t bytes = 0;           // Bytes of storage allocated
+            size_t comparisons = 0;     // Elements compared with ==, !=, <, >, <= or >=
+            size_t invocations = 0;     // Calls to predicates and projections wrapped with count_calls
+
+            counters& operator+=(const counters& rhs)
             {
-                auto newLength = this->size() + length;
-                if (newLength < 0)
-                    return list<list>();
-                return substrings(newLength);
+                this->copies += rhs.copies;
+                this->moves += rhs.moves;
+                this->allocations += rhs.allocations;
+                this->bytes += rhs.bytes;
+                this->comparisons += rhs.comparisons;
+                this->invocations += rhs.invocations;
+                return *this;
             }
 
-            if (length > this->size())
-                return list<list>({ {} });
+            friend counters operator-(counters lhs, const counters& rhs)
+            {
+                lhs.copies -= rhs.copies;
+                lhs.moves -= rhs.moves;
+                lhs.allocations -= rhs.allocations;
+                lhs.bytes -= rhs.bytes;
+                lhs.comparisons -= rhs.comparisons;
+                lhs.invocations -= rhs.invocations;
+                return lhs;
+            }
+        };
 
-            list<list> result = list<list>();
-            for (size_t i = 0; i <= this->size() - length; i++)
-                result.push_back(this->slice(i, (long)length));
+#ifdef EASY_LIST_INSTRUMENT
+        inline constexpr bool enabled = true;
 
-            // Remove duplicates before returning
-            return result.removeDuplicates();
+        namespace detail
+        {
+            inline counters& current()
+            {
+                thread_local counters counts;
+                return counts;
+            }
+
+            inline std::mutex& reportMutex()
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            inline std::map<std::string, counters>& reportTotals()
+            {
+                static std::map<std::string, counters> totals;
+                return totals;
+            }
+
+            // Holds the counted value, deriving from it where possible so that member pointers to the value's class can be used on it
+            template <typename _Type, bool = std::is_class_v<_Type> && !std::is_final_v<_Type>>
+            class counted_value : public _Type
+            {
+            public:
+                counted_value() : _Type() {}
+                counted_value(const _Type& value) : _Type(value) {}
+                counted_value(_Type&& value) : _Type(std::move(value)) {}
+
+                _Type& get() noexcept { return *this; }
+                const _Type& get() const noexcept { return *this; }
+            };
+
+            template <typename _Type>
+            class counted_value<_Type, false>
+            {
+            public:
+                counted_value() : value() {}
+                counted_value(const _Type& value) : value(value) {}
+                counted_value(_Type&& value) : value(std::move(value)) {}
+
+                _Type& get() noexcept { return this->value; }
+                const _Type& get() const noexcept { return this->value; }
+
+                operator _Type&() noexcept { return this->value; }
+                operator const _Type&() const noexcept { return this->value; }
+
+            private:
+                _Type value;
+            };
         }
 
         /// <summary>
-        /// Returns a list of all unique substrings of this list.
+        /// The counts for this thread so far.
         /// </summary>
-        list<list> substrings() const
-        {
-            list<list> result = list<list>();
-            for (size_t length = 0; length <= this->size(); length++)
-                result += substrings(length);
-            return result;
-        }
+        inline counters snapshot() { return detail::current(); }
 
-        ///////////////
-        /// SHUFFLE ///
-        ///////////////
+        /// <summary>
+        /// Sets the counts for this thread back to zero.
+        /// </summary>
+        inline void reset() { detail::current() = counters(); }
 
         /// <summary>
-        /// Randomises the order of elements in this list.
+        /// Counts the costs of one call, such as a single list operation.
         /// </summary>
-        /// <returns>This list, after the shuffle.</returns>
-        list& shuffle()
+        /// <param name="call">A callable object taking no arguments.</param>
+        /// <returns>The costs counted on this thread during the call.</returns>
+        template <typename _Callable>
+        counters measure(_Callable&& call)
         {
-            std::shuffle(this->begin(), this->end(), std::default_random_engine((unsigned int)time(NULL)));
-            return *this;
+            const counters before = snapshot();
+            std::forward<_Callable>(call)();
+            return snapshot() - before;
         }
 
+        /// <summary>
+        /// Adds the costs counted on this thread while it exists to a running total under its name, so that the costs of a call site
+        /// can be gathered across many calls, and threads. Scopes may be nested, in which case the outer one includes the inner.
+        /// </summary>
+        class scope
+        {
+        public:
+            explicit scope(const char* name) : name(name), start(snapshot()) {}
 
-        ///////////////
-        /// REVERSE ///
-        ///////////////
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+
+            ~scope()
+            {
+                const counters spent = snapshot() - this->start;
+                std::lock_guard<std::mutex> lock(detail::reportMutex());
+                detail::reportTotals()[this->name] += spent;
+            }
+
+        private:
+            const char* name;
+            counters start;
+        };
 
         /// <summary>
-        /// Reverses the order of elements in this list, and returns the result.
+        /// The totals gathered by scopes so far, by name.
         /// </summary>
-        [[nodiscard]] list reverse() const
+        inline std::map<std::string, counters> report()
         {
-            list result = list();
-            for (int i = (int)this->size() - 1; i >= 0; i--)
-                result.push_back((*this)[i]);
-            return result;
+            std::lock_guard<std::mutex> lock(detail::reportMutex());
+            return detail::reportTotals();
+        }
+
+        /// <summary>
+        /// Clears the totals gathered by scopes.
+        /// </summary>
+        inline void resetReport()
+        {
+            std::lock_guard<std::mutex> lock(detail::reportMutex());
+            detail::reportTotals().clear();
         }
 
+        template <typename _Type>
+        class counted;
 
-        /////////////////
-        /// POWER SET ///
-        /////////////////
+        template <typename _Type>
+        struct is_counted : std::false_type {};
+
+        template <typename _Type>
+        struct is_counted<counted<_Type>> : std::true_type {};
 
-        list<list> powerSet() const
+        /// <summary>
+        /// An element which counts its copies, moves and comparisons. Objects of a class type are derived from, so their members,
+        /// and member pointers to them, work as before; anything else converts implicitly to a reference to the value.
+        /// </summary>
+        /// <typeparam name="_Type">The type of the value counted.</typeparam>
+        template <typename _Type>
+        class counted : public detail::counted_value<_Type>
         {
-            // Remove duplicates
-            list set = this->removeDuplicates();
+            using _Mybase = detail::counted_value<_Type>;
 
-            // Start off with the empty set
-            list<list> result = list<list>({ {} });
+            template <typename _Other>
+            static const auto& unwrap(const _Other& value)
+            {
+                if constexpr (is_counted<_Other>::value)
+                    return value.get();
+                else
+                    return value;
+            }
 
-            // Generate the power set iteratively - on each iteration,
-            // append a duplicate with the next element in this list prepended to each element in the result
-            for (auto elem : set)
-                result += result.transform<list>([elem](list li) -> list { return list({ elem }) + li; });
+        public:
+            counted() : _Mybase() {}
+            counted(const _Type& value) : _Mybase(value) { detail::current().copies++; }
+            counted(_Type&& value) : _Mybase(std::move(value)) { detail::current().moves++; }
+            counted(const counted& other) : _Mybase(other.get()) { detail::current().copies++; }
+            counted(counted&& other) noexcept(std::is_nothrow_move_constructible_v<_Type>) : _Mybase(std::move(other.get())) { detail::current().moves++; }
 
-            return result;
-        }
+            // Making a value from something else, as braces or a conversion would, isn't a copy of an element
+            template <
+                typename _Other,
+                std::enable_if_t<
+                    std::conjunction_v<
+                        std::negation<std::is_same<std::decay_t<_Other>, _Type>>,
+                        std::negation<is_counted<std::decay_t<_Other>>>,
+                        std::is_convertible<_Other, _Type>
+                    >,
+                    bool
+                > = true
+            >
+            counted(_Other&& value) : _Mybase(_Type(std::forward<_Other>(value))) {}
 
+            template <typename _First, typename _Second, typename... _Rest, typename = decltype(_Type{ std::declval<_First>(), std::declval<_Second>(), std::declval<_Rest>()... })>
+            counted(_First&& first, _Second&& second, _Rest&&... rest)
+                : _Mybase(_Type{ std::forward<_First>(first), std::forward<_Second>(second), std::forward<_Rest>(rest)... }) {}
+
+            counted& operator=(const counted& other)
+            {
+                this->get() = other.get();
+                detail::current().copies++;
+                return *this;
+            }
+
+            counted& operator=(counted&& other) noexcept(std::is_nothrow_move_assignable_v<_Type>)
+            {
+                this->get() = std::move(other.get());
+                detail::current().moves++;
+                return *this;
+            }
+
+            template <typename _Other>
+            friend auto operator==(const counted& lhs, const _Other& rhs) -> decltype(bool(lhs.get() == unwrap(rhs)))
+            {
+                detail::current().comparisons++;
+                return lhs.get() == unwrap(rhs);
+            }
+
+            template <typename _Other>
+            friend auto operator!=(const counted& lhs, const _Other& rhs) -> decltype(bool(lhs.get() == unwrap(rhs)))
+            {
+                detail::current().comparisons++;
+                return !(lhs.get() == unwrap(rhs));
+            }
+
+            template <typename _Other>
+            friend auto operator<(const counted& lhs, const _Other& rhs) -> decltype(bool(lhs.get() < unwrap(rhs)))
+            {
+                detail::current().comparisons++;
+                return lhs.get() < unwrap(rhs);
+            }
+
+            template <typename _Other>
+            friend auto operator>(const counted& lhs, const _Other& rhs) -> decltype(bool(unwrap(rhs) < lhs.get()))
+            {
+                detail::current().comparisons++;
+                return unwrap(rhs) < lhs.get();
+            }
+
+            template <typename _Other>
+            friend auto operator<=(const counted& lhs, const _Other& rhs) -> decltype(bool(unwrap(rhs) < lhs.get()))
+            {
+                detail::current().comparisons++;
+                return !(unwrap(rhs) < lhs.get());
+            }
+
+            template <typename _Other>
+            friend auto operator>=(const counted& lhs, const _Other& rhs) -> decltype(bool(lhs.get() < unwrap(rhs)))
+            {
+                detail::current().comparisons++;
+                return !(lhs.get() < unwrap(rhs));
+            }
+
+            // With a plain value on the left, which would otherwise be ambiguous with the above when both sides are counted
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator==(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs == lhs)) { return rhs == lhs; }
+
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator!=(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs != lhs)) { return rhs != lhs; }
+
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator<(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs > lhs)) { return rhs > lhs; }
+
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator>(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs < lhs)) { return rhs < lhs; }
+
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator<=(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs >= lhs)) { return rhs >= lhs; }
+
+            template <typename _Other, std::enable_if_t<!is_counted<_Other>::value, bool> = true>
+            friend auto operator>=(const _Other& lhs, const counted& rhs) -> decltype(bool(rhs <= lhs)) { return rhs <= lhs; }
+        };
 
-        ///////////////
-        /// MIN/MAX ///
-        ///////////////
-        
         /// <summary>
-        /// Finds the maximum under the given comparison.
+        /// An allocator which counts the allocations made through it, and their size, then passes them on to another allocator.
         /// </summary>
-        /// <typeparam name="_Compare">A comparison object type.</typeparam>
-        /// <param name="comparer">The comparison function.</param>
-        /// <returns>The greatest element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
-        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
-        [[nodiscard]] _Type max(const _Compare comparer) const
+        /// <typeparam name="_Type">The type of the elements allocated</typeparam>
+        /// <typeparam name="_Base">The allocator which does the allocating.</typeparam>
+        template <typename _Type, typename _Base = std::allocator<_Type>>
+        class counting_allocator : public _Base
         {
-            return *std::max_element(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
-        }
+        public:
+            using value_type = _Type;
+
+            template <typename _Other>
+            struct rebind { using other = counting_allocator<_Other, typename std::allocator_traits<_Base>::template rebind_alloc<_Other>>; };
+
+            counting_allocator() = default;
+            counting_allocator(const _Base& base) : _Base(base) {}
+
+            template <typename _Other, typename _OtherBase>
+            counting_allocator(const counting_allocator<_Other, _OtherBase>& other) : _Base(other.base()) {}
+
+            _Type* allocate(const size_t count)
+            {
+                detail::current().allocations++;
+                detail::current().bytes += count * sizeof(_Type);
+                return std::allocator_traits<_Base>::allocate(this->base(), count);
+            }
+
+            void deallocate(_Type* pointer, const size_t count)
+            {
+                std::allocator_traits<_Base>::deallocate(this->base(), pointer, count);
+            }
+
+            _Base& base() noexcept { return *this; }
+            const _Base& base() const noexcept { return *this; }
+
+            friend bool operator==(const counting_allocator& lhs, const counting_allocator& rhs) { return lhs.base() == rhs.base(); }
+            friend bool operator!=(const counting_allocator& lhs, const counting_allocator& rhs) { return !(lhs == rhs); }
+        };
 
         /// <summary>
-        /// Finds the maximum under a default comparison.
+        /// A predicate, projection or other callable object which counts its calls.
         /// </summary>
-        /// <returns>The greatest element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
-        [[nodiscard]] _Type max() const
+        template <typename _Callable>
+        class counted_callable
         {
-            return *std::max_element(this->begin(), this->end());
-        }
+        public:
+            explicit counted_callable(_Callable callable) : callable(std::move(callable)) {}
+
+            template <typename... _Args>
+            auto operator()(_Args&&... args) const -> decltype(std::invoke(std::declval<const _Callable&>(), std::forward<_Args>(args)...))
+            {
+                detail::current().invocations++;
+                return std::invoke(this->callable, std::forward<_Args>(args)...);
+            }
+
+        private:
+            _Callable callable;
+        };
 
         /// <summary>
-        /// Finds the minimum under the given comparison.
+        /// Wraps a predicate or projection so that its calls are counted. Member pointers become callable objects, so pass the result
+        /// where a list takes a predicate or transformer, rather than a member.
         /// </summary>
-        /// <typeparam name="_Compare">A comparison object type.</typeparam>
-        /// <param name="comparer">The comparison function.</param>
-        /// <returns>The least element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
-        template <typename _Compare, std::enable_if_t<template_helpers::is_comparison_v<_Compare, _Type>, bool> = true>
-        [[nodiscard]] _Type min(const _Compare comparer) const
+        template <typename _Callable>
+        counted_callable<_Callable> count_calls(_Callable callable)
         {
-            return *std::min_element(this->begin(), this->end(), template_helpers::cast_static_comparison<_Compare, _Type>(comparer));
+            return counted_callable<_Callable>(std::move(callable));
+        }
+#else
+        inline constexpr bool enabled = false;
+
+        inline counters snapshot() { return counters(); }
+        inline void reset() {}
+        inline std::map<std::string, counters> report() { return {}; }
+        inline void resetReport() {}
+
+        template <typename _Callable>
+        counters measure(_Callable&& call)
+        {
+            std::forward<_Callable>(call)();
+            return counters();
         }
 
+        class scope
+        {
+        public:
+            explicit scope(const char*) {}
+        };
+
+        template <typename _Type>
+        using counted = _Type;
+
+        template <typename _Type, typename _Base = std::allocator<_Type>>
+        using counting_allocator = _Base;
+
+        template <typename _Callable>
+        _Callable count_calls(_Callable callable) { return callable; }
+#endif
+    }
+
+    /// <summary>
+    /// A list which counts the copies, moves and comparisons of its elements, and its allocations, when EASY_LIST_INSTRUMENT is defined;
+    /// and is exactly list<T> when it isn't.
+    /// </summary>
+    /// <typeparam name="_Type">The type of the elements of the list</typeparam>
+    template <typename _Type>
+    using counted_list = list<instrumentation::counted<_Type>, instrumentation::counting_allocator<instrumentation::counted<_Type>>>;
+
+#ifdef EASY_LIST_PMR
+    namespace pmr
+    {
         /// <summary>
-        /// Finds the minimum under a default comparison.
+        /// A list whose elements, and the results of every operation on it, are allocated from a std::pmr::memory_resource, such as an arena.
         /// </summary>
-        /// <returns>The least element in the list, if the comparison ordering is linear (otherwise, the return value is not defined).</returns>
-        [[nodiscard]] _Type min() const
+        template <typename _Type>
+        using list = easy_list::list<_Type, std::pmr::polymorphic_allocator<_Type>>;
+
+        /// <summary>
+        /// A sorted list whose elements are allocated from a std::pmr::memory_resource.
+        /// </summary>
+        template <typename _Type, typename _Compare = std::less<>>
+        using sorted_list = easy_list::sorted_list<_Type, _Compare, std::pmr::polymorphic_allocator<_Type>>;
+
+        /// <summary>
+        /// A monotonic arena: allocating is a pointer bump, freeing does nothing, and everything allocated is released at once when the arena
+        /// is destroyed or release() is called. The first allocations come from a buffer inside the arena itself; after that, from the upstream resource.
+        /// Not safe to allocate from on several threads at once, so list::par() mustn't be used on lists in an arena.
+        /// </summary>
+        /// <typeparam name="_InlineBytes">The size of the buffer inside the arena.</typeparam>
+        template <size_t _InlineBytes = 4096>
+        class arena : public std::pmr::monotonic_buffer_resource
         {
-            return *std::min_element(this->begin(), this->end());
-        }
+        public:
+            arena() : std::pmr::monotonic_buffer_resource(buffer, _InlineBytes) {}
+
+            explicit arena(std::pmr::memory_resource* upstream) : std::pmr::monotonic_buffer_resource(buffer, _InlineBytes, upstream) {}
+
+            arena(const arena&) = delete;
+            arena& operator=(const arena&) = delete;
+
+            /// <summary>
+            /// Makes an empty list allocating from this arena.
+            /// </summary>
+            template <typename _Type>
+            [[nodiscard]] pmr::list<_Type> makeList()
+            {
+                return pmr::list<_Type>(std::pmr::polymorphic_allocator<_Type>(this));
+            }
+
+        private:
+            alignas(std::max_align_t) unsigned char buffer[_InlineBytes];
+        };
+    }
+#endif
+}
 
+#ifdef EASY_LIST_INSTRUMENT
+namespace std
+{
+    // Counted elements hash as their values do, so that hashed operations such as unify still apply
+    template <typename _Type>
+    struct hash<easy_list::instrumentation::counted<_Type>>
+    {
+        template <typename _Value = _Type>
+        auto operator()(const easy_list::instrumentation::counted<_Value>& value) const -> decltype(std::hash<_Value>()(value.get()))
+        {
+            return std::hash<_Value>()(value.get());
+        }
     };
 }
+#endif
 
 #else
 
@@ -1,7 +1,17 @@
 // easylist.cpp : This file contains the 'main' function. Program execution begins and ends there.
 //
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
 #include "easy_list.h"
 
 using namespace easy_list;
@@ -34,9 +44,816 @@ bool isEven(const C& c) {
 C plusN(const C& c, int n) { return C(c.get() + n); }
 C plusOne(const C& c) { return plusN(c, 1); }
 
+// Only equatable, so set operations on it fall back to pairwise comparison
+struct Plain
+{
+    int n;
+    bool operator==(const Plain& other) const { return n == other.n; }
+};
+
+// Counts how often its key is computed
+struct Keyed
+{
+    int key;
+    int order;
+    static inline size_t calls = 0;
+    int getKey() const { calls++; return key; }
+};
+
+// Whether two numbers are the same, telling zeroes of either sign apart and treating NaNs as the same
+template <typename _Number>
+bool identical(const _Number lhs, const _Number rhs)
+{
+    if constexpr (std::is_floating_point_v<_Number>)
+    {
+        if (std::isnan(lhs) || std::isnan(rhs))
+            return std::isnan(lhs) && std::isnan(rhs);
+        return lhs == rhs && std::signbit(lhs) == std::signbit(rhs);
+    }
+    else
+    {
+        return lhs == rhs;
+    }
+}
+
+int failures = 0;
+
+void check(const bool passed, const char* what)
+{
+    if (!passed)
+    {
+        std::cout << "FAILED: " << what << "\n";
+        failures++;
+    }
+}
+
+void testSets()
+{
+    const list<int> empty;
+    const list<int> one{ 7 };
+    const list<int> left{ 3, 1, 3, 2, 1 };
+    const list<int> right{ 2, 4, 3, 4 };
+    check(left.unify(right) == list<int>{ 3, 1, 2, 4 }, "unify (hash)");
+    check(left.disjoin(right) == list<int>{ 2, 3 }, "disjoin (hash)");
+    check(left.removeDuplicates() == list<int>{ 3, 1, 2 }, "removeDuplicates (hash)");
+    check(empty.unify(empty).empty() && empty.disjoin(left).empty() && empty.removeDuplicates().empty(), "set operations on empty lists");
+    check(one.unify(empty) == one && one.disjoin(one) == one && one.removeDuplicates() == one, "set operations on one element");
+    check(!empty.shares(left) && left.shares(right), "shares");
+
+    const list<C> ordered{ C(3), C(1), C(3), C(2) };
+    check(ordered.removeDuplicates() == list<C>{ C(3), C(1), C(2) }, "removeDuplicates (sort)");
+    check(ordered.disjoin(list<C>{ C(2), C(3) }) == list<C>{ C(2), C(3) }, "disjoin (sort)");
+
+    const list<Plain> plain{ { 5 }, { 6 }, { 5 } };
+    check(plain.removeDuplicates().size() == 2 && plain.unify(list<Plain>{ { 7 } }).size() == 3, "set operations (equality only)");
+}
+
+void testPipelines()
+{
+    const list<C> cs{ C(1), C(2), C(3), C(4), C(5) };
+    const list<C> empty;
+    check(cs.lazy().select(isEven).transform(plusOne).toList() == list<C>{ C(3), C(5) }, "lazy select then transform");
+    check(cs.lazy().removeAll(isEven).transform(&C::get).toList() == list<int>{ 1, 3, 5 }, "lazy removeAll then member transform");
+    const list<Keyed> keyed{ { 1, 2 } };
+    check(keyed.transform<int>(&Keyed::key) == list<int>{ 1 } && keyed.transform<int>(&Keyed::order) == list<int>{ 2 }, "transform by each of two members of one type");
+    check(keyed.lazy().transform(&Keyed::order).toList() == keyed.transform<int>(&Keyed::order), "lazy and eager member transforms agree");
+    check(cs.lazy().replace(C(0), isEven).toList() == list<C>{ C(1), C(0), C(3), C(0), C(5) }, "lazy replace");
+    check(cs.lazy().select(isEven).count() == cs.count(isEven), "lazy count");
+    check(cs.lazy().transform(&C::getDiff, 3).max() == 2 && cs.lazy().select(isEven).min() == C(2), "lazy min and max");
+    check(empty.lazy().select(isEven).toList().empty() && empty.lazy().count() == 0 && !empty.lazy().contains(C(1)), "empty pipeline");
+    check(list<C>{ C(9) }.lazy().transform(plusOne).toList() == list<C>{ C(10) }, "single-element pipeline");
+
+    bool threw = false;
+    try { (void)empty.lazy().max(); }
+    catch (const std::bad_optional_access&) { threw = true; }
+    check(threw, "max of an empty pipeline throws");
+
+    size_t visited = 0;
+    const bool found = cs.lazy().transform([&visited](const C& c) -> int { visited++; return c.get(); }).contains(2);
+    check(found && visited == 2, "lazy contains stops at the first match");
+}
+
+void testQuantifiers()
+{
+    const list<C> cs{ C(1), C(2), C(3), C(4) };
+    const list<C> empty;
+    check(cs.count(isEven) == 2 && cs.count(C(3)) == 1 && cs.count(4, &C::get) == 1 && cs.count(1, &C::getDiff, 3) == 2, "count");
+    check(cs.any(isEven) && !cs.all(isEven) && !cs.none(isEven), "any, all and none by predicate");
+    check(cs.any(C(4)) && cs.none(C(7)) && cs.any(1, &C::getDiff, 5) && !cs.all(4, &C::get), "any, all and none by match and member");
+    check(!empty.any(isEven) && empty.all(isEven) && empty.none(isEven) && empty.count(isEven) == 0, "quantifiers on an empty list");
+    check(list<C>{ C(2) }.all(isEven) && list<C>{ C(1) }.none(isEven), "quantifiers on one element");
+
+    size_t calls = 0;
+    const auto counted = [&calls](const C& c) -> bool { calls++; return isEven(c); };
+    check(cs.any(counted) && calls == 2, "any stops at the first match");
+    calls = 0;
+    check(!cs.all(counted) && calls == 1, "all stops at the first mismatch");
+}
+
+void testInPlace()
+{
+    const list<C> cs{ C(1), C(2), C(3), C(4), C(2) };
+
+    list<C> selected = cs;
+    const C* buffer = selected.data();
+    check(selected.selectInPlace(isEven) == cs.select(isEven) && selected.data() == buffer, "selectInPlace keeps the buffer");
+    list<C> removed = cs;
+    check(removed.removeAllInPlace(2, &C::get) == cs.removeAll(2, &C::get), "removeAllInPlace by member");
+    list<C> first = cs;
+    check(first.removeFirstInPlace(C(2)) == list<C>{ C(1), C(3), C(4), C(2) }, "removeFirstInPlace removes only the first");
+    list<C> replaced = cs;
+    check(replaced.replaceInPlace(plusOne, isEven) == cs.replace(plusOne, isEven), "replaceInPlace with a transformer");
+    list<C> unmatched = cs;
+    check(unmatched.removeFirstInPlace(C(9)) == cs && unmatched.selectInPlace(C(9)).empty(), "in-place operations with no match");
+
+    list<C> empty;
+    check(empty.selectInPlace(isEven).removeAllInPlace(isEven).replaceInPlace(C(0), isEven).empty(), "in-place operations on an empty list");
+    list<C> one{ C(2) };
+    check(one.removeAllInPlace(isEven).empty(), "removeAllInPlace of the only element");
+}
+
+void testRvalues()
+{
+    list<C> source{ C(1), C(2), C(3), C(4), C(5), C(6) };
+    const list<C> copy = source;
+    const C* buffer = source.data();
+    list<C> chained = std::move(source).select(isEven).reverse().slice(0, 2);
+    check(chained == list<C>{ C(6), C(4) } && chained.data() == buffer, "rvalue select, reverse and slice reuse the buffer");
+    check(copy.select(isEven).reverse().slice(0, 2) == chained, "rvalue chain matches the copying chain");
+
+    list<C> appended{ C(1) };
+    appended.reserve(4);
+    buffer = appended.data();
+    list<C> sum = std::move(appended) + C(2);
+    check(sum == list<C>{ C(1), C(2) } && sum.data() == buffer, "rvalue + reuses the buffer");
+
+    check(list<C>().select(isEven).reverse().slice().empty(), "rvalue operations on an empty list");
+    check(list<C>{ C(4) }.removeAt(0).empty() && list<C>{ C(4) }.reverse() == list<C>{ C(4) }, "rvalue operations on one element");
+}
+
+void testSortByMember()
+{
+    const list<Keyed> keyed{ { 3, 0 }, { 1, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 } };
+    list<Keyed> sorted = keyed;
+    Keyed::calls = 0;
+    sorted.stableSort([](int lhs, int rhs) -> bool { return lhs > rhs; }, &Keyed::getKey);
+    check(Keyed::calls == keyed.size(), "sort by method computes each key once");
+    check(sorted.transform<int>(&Keyed::order) == list<int>{ 0, 2, 3, 1, 4 }, "stable sort by method keeps ties in order");
+
+    list<C> cs{ C(5), C(1), C(4) };
+    check(cs.sort(&C::getDiff, 4).transform<int>(&C::get) == list<int>{ 4, 5, 1 }, "sort by method with an argument");
+
+    list<Keyed> empty;
+    list<Keyed> one{ { 7, 0 } };
+    Keyed::calls = 0;
+    empty.sort(&Keyed::getKey);
+    one.sort(&Keyed::getKey);
+    check(empty.empty() && one.size() == 1 && Keyed::calls <= 1, "sort by method on empty and single-element lists");
+}
+
+void testParallel()
+{
+    thread_pool& pool = thread_pool::shared();
+    const size_t workers = pool.workers();
+    pool.configure(3);
+
+    list<C> big;
+    for (int i = 0; i < 100000; i++)
+        big.push_back(C(i % 977));
+    const auto small = [](const C& c) -> bool { return c.n < 10; };
+
+    check(big.par().select(isEven) == big.select(isEven), "parallel select keeps the serial order");
+    check(big.par().count(isEven) == big.count(isEven) && big.par().count(5, &C::get) == big.count(5, &C::get), "parallel count");
+    check(big.par().transform<C>(plusOne) == big.transform<C>(plusOne), "parallel transform");
+    check(big.par().replace(C(-1), isEven) == big.replace(C(-1), isEven), "parallel replace");
+    check(big.par().search(C(976)) == big.begin() + 976 && big.par().search(C(5000)) == big.end(), "parallel search finds the first match");
+    check(big.par().select(small).size() == big.count(small), "parallel select by lambda");
+
+    bool threw = false;
+    try { (void)big.par().count([](const C& c) -> bool { if (c.n == 900) throw std::runtime_error("stop"); return true; }); }
+    catch (const std::runtime_error&) { threw = true; }
+    check(threw, "parallel operations rethrow exceptions");
+
+    const list<C> empty;
+    const list<C> one{ C(2) };
+    check(empty.par().select(isEven).empty() && empty.par().count(isEven) == 0 && empty.par().search(C(1)) == empty.end(), "parallel operations on an empty list");
+    check(one.par().select(isEven) == one && one.par().transform<int>(&C::get) == list<int>{ 2 }, "parallel operations on one element");
+
+    pool.configure(workers);
+}
+
+void testThreadPool()
+{
+    thread_pool& pool = thread_pool::shared();
+    const size_t workers = pool.workers();
+    list<C> big;
+    for (int i = 0; i < 50000; i++)
+        big.push_back(C(i));
+
+    pool.configure(3);
+    // A transformer which itself runs parallel work must not deadlock, with both levels split over several chunks
+    const list<size_t> nested = big.par().transform<size_t>([&big](const C& c) -> size_t { return c.n % 1000 == 0 ? big.par().count(c.n, &C::get) : 1; });
+    check(nested == list<size_t>(big.size(), 1), "nested parallel operations");
+
+    pool.configure(0);
+    check(pool.workers() == 0 && big.par().count(isEven) == 25000, "a pool with no workers runs on the calling thread");
+    pool.configure(2);
+    check(pool.workers() == 2 && big.par().select(isEven) == big.select(isEven), "a reconfigured pool");
+
+    bool threw = false;
+    try { (void)big.par().count([&pool](const C&) -> bool { pool.configure(1); return true; }); }
+    catch (const std::logic_error&) { threw = true; }
+    check(threw && pool.workers() == 2, "configure from inside a parallel operation throws");
+
+    pool.configure(workers);
+}
+
+// Checks the vectorised min, max, count and search against the standard algorithms at every length up to a few vectors,
+// with the special value at every position
+template <typename _Number>
+bool matchesScalar(const _Number special, const _Number filler)
+{
+    for (size_t size = 1; size <= 70; size++)
+    {
+        for (size_t at = 0; at < size; at++)
+        {
+            list<_Number> numbers;
+            for (size_t i = 0; i < size; i++)
+                numbers.push_back(i == at ? special : (_Number)(filler + (_Number)(i % 5)));
+            const std::vector<_Number>& plain = numbers;
+            if (!identical(numbers.max(), *std::max_element(plain.begin(), plain.end()))
+                || !identical(numbers.min(), *std::min_element(plain.begin(), plain.end()))
+                || numbers.count(special) != (size_t)std::count(plain.begin(), plain.end(), special)
+                || numbers.search(special) != std::find(plain.begin(), plain.end(), special))
+                return false;
+        }
+    }
+    return true;
+}
+
+void testSimd()
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    check(matchesScalar<int>(-7, 0) && matchesScalar<int>(INT_MAX, 0) && matchesScalar<long long>(LLONG_MIN, 3), "vectorised integers");
+    check(matchesScalar<double>(nan, 1.0) && matchesScalar<float>((float)nan, 1.0f), "vectorised NaN");
+    check(matchesScalar<double>(-0.0, 0.0) && matchesScalar<double>(0.0, -0.0) && matchesScalar<float>(-0.0f, 0.0f), "vectorised zeroes of either sign");
+    check(matchesScalar<double>(-1.0, -0.0) && matchesScalar<float>(2.5f, -0.0f), "vectorised min and max among zeroes");
+
+    const list<double> one{ -0.0 };
+    check(std::signbit(one.max()) && std::signbit(one.min()) && one.count(0.0) == 1 && one.contains(0.0), "vectorised operations on one element");
+    const list<double> empty;
+    check(empty.count(0.0) == 0 && !empty.contains(nan) && empty.search(1.0) == empty.end(), "vectorised operations on an empty list");
+}
+
+void testExtremes()
+{
+    const list<Keyed> keyed{ { 3, 0 }, { 1, 1 }, { 3, 2 }, { 2, 3 }, { 1, 4 } };
+    const auto byKey = [](const Keyed& lhs, const Keyed& rhs) -> bool { return lhs.key < rhs.key; };
+    const auto bounds = keyed.minmax(byKey);
+    check(bounds.first.order == 1 && bounds.second.order == 0, "minmax gives the first least and first greatest");
+    check(keyed.minmax(&Keyed::key).first.order == keyed.min(byKey).order, "minmax by member");
+
+    check(keyed.top(2, byKey).transform<int>(&Keyed::order) == list<int>{ 0, 2 }, "top keeps ties in list order");
+    check(keyed.bottom(3, &Keyed::key).transform<int>(&Keyed::order) == list<int>{ 1, 4, 3 }, "bottom by member");
+    check(keyed.top(0, byKey).empty() && keyed.bottom(10, byKey).size() == keyed.size(), "top and bottom of none, and of more than the list");
+
+    const list<int> one{ 4 };
+    check(one.minmax() == std::make_pair(4, 4) && one.top(3) == one && one.bottom(1) == one, "extremes of one element");
+    const list<int> empty;
+    check(empty.top(2).empty() && empty.bottom(2).empty(), "top and bottom of an empty list");
+}
+
+void testRadixSort()
+{
+    for (const size_t size : { (size_t)0, (size_t)1, (size_t)50, (size_t)5000 })
+    {
+        list<int> ints;
+        list<double> doubles;
+        list<Keyed> keyed;
+        for (size_t i = 0; i < size; i++)
+        {
+            const int value = (int)((i * 7919) % 1000) - 500;
+            ints.push_back(value);
+            doubles.push_back(value % 3 == 0 ? (i % 2 ? 0.0 : -0.0) : value * 0.25);
+            keyed.push_back({ value % 10, (int)i });
+        }
+
+        std::vector<int> expectedInts = ints;
+        std::stable_sort(expectedInts.begin(), expectedInts.end(), std::greater<>{});
+        check(ints.sort(std::greater<>{}) == expectedInts, "radix sort of integers, descending");
+
+        // Zeroes of either sign compare equal, so a stable sort keeps them in their original order
+        std::vector<double> expectedDoubles = doubles;
+        std::stable_sort(expectedDoubles.begin(), expectedDoubles.end());
+        doubles.sort();
+        bool sameSigns = true;
+        for (size_t i = 0; i < size; i++)
+            sameSigns = sameSigns && identical(doubles[(long)i], expectedDoubles[i]);
+        check(sameSigns, "radix sort of doubles is stable across zeroes of either sign");
+
+        list<Keyed> expectedKeyed = keyed;
+        std::stable_sort(expectedKeyed.begin(), expectedKeyed.end(), [](const Keyed& lhs, const Keyed& rhs) -> bool { return lhs.key < rhs.key; });
+        check(keyed.sort(&Keyed::key).transform<int>(&Keyed::order) == expectedKeyed.transform<int>(&Keyed::order), "radix sort by member is stable");
+    }
+}
+
+void testSortedList()
+{
+    const list<int> numbers{ 5, 1, 4, 1, 3 };
+    auto ascending = numbers.toSorted();
+    auto descending = numbers.toSorted(std::greater<>{});
+    check(ascending.toList() == list<int>{ 1, 1, 3, 4, 5 } && descending.toList() == list<int>{ 5, 4, 3, 1, 1 }, "toSorted in either direction");
+    check(ascending.first() == 1 && ascending.last() == 5 && descending.first() == 5 && descending.last() == 1, "first and last follow the comparison");
+    check(descending.count(1) == 2 && descending.contains(4) && !descending.contains(2) && *descending.search(3) == 3, "binary search with a descending comparer");
+
+    descending.insert(2);
+    descending.insert(list<int>{ 6, 0 });
+    check(descending.toList() == list<int>{ 6, 5, 4, 3, 2, 1, 1, 0 }, "insert keeps a descending order");
+    check(descending.remove(1) == 2 && descending.size() == 6, "remove every match");
+
+    const auto other = list<int>{ 0, 3, 7 }.toSorted(std::greater<>{});
+    check(descending.unify(other).toList() == list<int>{ 7, 6, 5, 4, 3, 2, 0 } && descending.disjoin(other).toList() == list<int>{ 3, 0 }, "merges with a descending comparer");
+    check(descending.shares(other) && descending.removeDuplicates().size() == descending.size(), "shares and removeDuplicates");
+
+    const auto byValue = list<C>{ C(9), C(2), C(6) }.toSorted(std::greater<>{}, &C::get);
+    check(byValue.toList() == list<C>{ C(9), C(6), C(2) }, "toSorted on a member, descending");
+    check(byValue.contains(6, &C::get) && byValue.count(2, &C::get) == 1 && !byValue.contains(5, &C::get), "member search on a descending list");
+    const auto byDiff = list<C>{ C(9), C(2), C(6) }.toSorted(&C::getDiff, 5);
+    check(byDiff.toList() == list<C>{ C(6), C(2), C(9) } && byDiff.contains(3, &C::getDiff, 5) && byDiff.count(4) == 1, "toSorted on a method with an argument");
+    const auto byKey = list<Keyed>{ { 3, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 } }.toSorted(&Keyed::getKey);
+    check(byKey.toList().transform<int>(&Keyed::order) == list<int>{ 1, 3, 2, 0 }, "toSorted on a member keeps ties in order");
+    check(byKey.count(1, &Keyed::getKey) == 2 && byKey.search(2, &Keyed::getKey)->order == 2 && byKey.contains(3) && !byKey.contains(4), "searching a list sorted on a member");
+
+    const sorted_list<int> empty;
+    check(empty.search(1) == empty.end() && !empty.contains(1) && empty.count(1) == 0 && empty.unify(ascending).toList() == list<int>{ 1, 3, 4, 5 }, "an empty sorted list");
+    const auto one = list<int>{ 8 }.toSorted(std::greater<>{});
+    check(one.first() == 8 && one.last() == 8 && one.contains(8) && one.disjoin(other).empty(), "a sorted list of one element");
+}
+
+void testGenerators()
+{
+    const list<int> distinct{ 1, 2, 3, 4 };
+    const auto subsets = distinct.lazyPowerSet();
+    check(subsets.size() == 16 && subsets.toList() == distinct.powerSet(), "lazyPowerSet gives the subsets of powerSet in order");
+    check(subsets[5] == subsets.at(5) && subsets.range(3, 7).toList() == distinct.powerSet().slice(3, 4), "indexing and ranges of the power set");
+
+    const auto windows = distinct.lazySubstrings(2);
+    check(windows.toList() == list<list<int>>{ { 1, 2 }, { 2, 3 }, { 3, 4 } }, "lazySubstrings of a given length");
+    check(distinct.lazySubstrings().size() == distinct.substrings().size(), "lazySubstrings of every length");
+
+    list<list<int>> pieces;
+    for (const auto& part : subsets.split(3))
+        part.forEach([&pieces](const list<int>& subset) -> void { pieces.push_back(subset); });
+    check(pieces == subsets.toList(), "split pieces cover the power set in order");
+
+    std::atomic<size_t> total{ 0 };
+    subsets.forEachParallel([&total](const list<int>& subset) -> void { total += subset.size(); });
+    check(total == 32, "forEachParallel visits every subset");
+
+    const list<int> empty;
+    check(empty.lazyPowerSet().size() == 1 && empty.lazyPowerSet()[0].empty() && empty.lazySubstrings().size() == empty.substrings().size(), "generators over an empty list");
+    check(list<int>{ 7 }.lazySubstrings(1).toList() == list<list<int>>{ { 7 } } && distinct.lazySubstrings(5).empty(), "substrings of one element, and longer than the list");
+}
+
+void testSubstrings()
+{
+    const list<int> repeats{ 1, 2, 1, 2, 1, 3 };
+    check(repeats.substrings(2) == list<list<int>>{ { 1, 2 }, { 2, 1 }, { 1, 3 } }, "substrings of a length keep the first of each");
+    check(repeats.substrings(3).size() == 3 && repeats.substrings(6) == list<list<int>>{ repeats }, "substrings up to the whole list");
+
+    list<int> periodic;
+    for (int i = 0; i < 2000; i++)
+        periodic.push_back(i % 7);
+    check(periodic.substrings(50).size() == 7, "rolling hash over a long periodic list");
+
+    const list<std::string> words{ "a", "b", "a", "b" };
+    check(words.substrings(2).size() == 2, "rolling hash over strings");
+    const list<C> unhashable{ C(1), C(1), C(1) };
+    check(unhashable.substrings(2) == list<list<C>>{ { C(1), C(1) } }, "substrings of elements without a hash");
+
+    const list<int> empty;
+    const list<int> one{ 4 };
+    // Asking for more than there is gives just the empty substring
+    check(empty.substrings(1).size() == 1 && empty.substrings(1)[0].empty(), "substrings of an empty list");
+    check(one.substrings(1) == list<list<int>>{ { 4 } } && one.substrings(2).size() == 1 && one.substrings(2)[0].empty(), "substrings of one element");
+}
+
+void testViews()
+{
+    const list<int> numbers{ 0, 1, 2, 3, 4, 5, 6 };
+    const auto middle = numbers.sliceView(2, 3);
+    check(middle.toList() == numbers.slice(2, 3) && middle.data() == numbers.data() + 2, "sliceView refers to the list's elements");
+    check(numbers.sliceView(-3).toList() == numbers.slice(-3) && numbers.sliceView(1, -2).toList() == numbers.slice(1, -2), "sliceView with negative start and length");
+    check(middle[-1] == 4 && middle.front() == 2 && middle.back() == 4, "indexing a slice view");
+
+    const auto backwards = numbers.reverseView();
+    check(backwards.toList() == numbers.reverse() && backwards[0] == 6 && backwards[-1] == 0, "reverseView");
+    check(backwards.slice(1, 3).toList() == list<int>{ 5, 4, 3 } && backwards.reverse().toList() == numbers, "views of views");
+    check(middle.select([](int n) -> bool { return n % 2 == 0; }) == list<int>{ 2, 4 } && middle.count(3) == 1 && backwards.max() == 6, "view operations");
+
+    const list<int> empty;
+    check(empty.sliceView().empty() && empty.reverseView().toList().empty() && numbers.sliceView(3, 0).empty(), "empty views");
+    const list<int> one{ 9 };
+    check(one.reverseView().toList() == one && one.sliceView(-1).front() == 9, "views of one element");
+}
+
+void testRemoveAt()
+{
+    const list<int> numbers{ 0, 1, 2, 3, 4, 5 };
+    check(numbers.removeAt(std::vector<int>{ 4, -1, 0, 4, 17 }) == list<int>{ 1, 2, 3 }, "removeAt with negative, repeated and missing indices");
+    check(numbers.removeRange(1, -2) == list<int>{ 0, 4, 5 } && numbers.removeRange(numbers.begin() + 2, numbers.end()) == list<int>{ 0, 1 }, "removeRange by index and iterator");
+
+    list<int> inPlace = numbers;
+    const int* buffer = inPlace.data();
+    inPlace.removeAtInPlace(std::vector<long>{ 5, 1, 3 }).removeAtInPlace(-1);
+    check(inPlace == list<int>{ 0, 2 } && inPlace.data() == buffer, "removeAtInPlace keeps the buffer");
+    inPlace = numbers;
+    check(inPlace.removeRangeInPlace(inPlace.begin() + 1, inPlace.begin() + 4) == list<int>{ 0, 4, 5 } && inPlace.removeRangeInPlace(0, -1) == list<int>{ 5 }, "removeRangeInPlace");
+
+    list<int> empty;
+    check(empty.removeAtInPlace(std::vector<int>{ 0, -1 }).empty() && numbers.removeAt(std::vector<int>{}) == numbers, "removeAt on an empty list, and of no indices");
+    list<int> one{ 3 };
+    check(one.removeAtInPlace(std::vector<int>{ 0, 0 }).empty(), "removeAtInPlace of the only element");
+}
+
+#ifdef EASY_LIST_PMR
+// A memory resource which counts the bytes allocated from it
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::atomic<size_t> allocated{ 0 };
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        this->allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override { std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+void testAllocators()
+{
+    pmr::arena<> arena;
+    pmr::list<int> numbers = arena.makeList<int>();
+    for (int i = 0; i < 10; i++)
+        numbers.push_back(i);
+    const auto inArena = [&arena](const auto& result) -> bool { return result.get_allocator().resource() == &arena; };
+    const auto isOdd = [](int n) -> bool { return n % 2 != 0; };
+
+    check(inArena(numbers.select(isOdd)) && inArena(numbers.slice(2, 3)) && inArena(numbers.reverse()) && inArena(numbers.unify(numbers)), "results are built in the list's arena");
+    check(inArena(numbers.transform<long>([](int n) -> long { return n; })), "transformed results are rebound into the arena");
+    check(inArena(numbers.sliceView(1, 4).toList()) && inArena(numbers.reverseView().select(isOdd)) && inArena(numbers.lazy().select(isOdd).toList()), "views and pipelines keep the arena");
+
+    // par() allocates from several threads at once, so needs a thread-safe resource
+    std::pmr::synchronized_pool_resource pool;
+    pmr::list<int> shared{ std::pmr::polymorphic_allocator<int>(&pool) };
+    for (int i = 0; i < 50000; i++)
+        shared.push_back(i);
+    const pmr::list<int> odd = shared.par().select(isOdd);
+    check(odd.get_allocator().resource() == &pool && odd.size() == 25000, "parallel results use the list's resource");
+
+    CountingResource counting;
+    pmr::list<int> deck{ std::pmr::polymorphic_allocator<int>(&counting) };
+    for (int i = 0; i < 1 << 17; i++)
+        deck.push_back(i);
+    const size_t before = counting.allocated;
+    deck.shuffleParallel(5);
+    check(counting.allocated - before >= deck.size() * sizeof(int) && deck.size() == 1 << 17, "a parallel shuffle takes its scratch space from the list's resource");
+
+    const pmr::list<int> empty = arena.makeList<int>();
+    check(inArena(empty.select(isOdd)) && inArena(empty.slice()), "results of an empty list are built in its arena");
+
+    auto sorted = list<int>{ 20, 1 }.toSorted();
+    sorted.insert(numbers);
+    check(sorted.size() == 12 && sorted.first() == 0 && sorted.last() == 20 && sorted.count(1) == 2, "a sorted list inserts a list with another allocator");
+}
+#endif
+
+void testSmallList()
+{
+    small_list<std::string, 2> words;
+    check(words.empty() && words.isInline() && words.capacity() == 2, "an empty small list is inline");
+    words.push_back("a");
+    check(words.size() == 1 && words.front() == "a" && words.isInline(), "one element stays inline");
+    words.emplace_back("b");
+    words.push_back("c");
+    check(!words.isInline() && words.size() == 3 && words.back() == "c", "growing past the inline capacity");
+    words.insert(words.begin(), "z");
+    words.erase(words.begin() + 1);
+    check(words[0] == "z" && words[1] == "b" && words.size() == 3, "insert and erase");
+    words.pop_back();
+    words.shrink_to_fit();
+    check(words.isInline() && words.size() == 2, "shrink_to_fit moves back inline");
+
+    small_list<std::string, 2> copy = words;
+    small_list<std::string, 2> big{ "1", "2", "3", "4" };
+    swap(copy, big);
+    check(copy.size() == 4 && big == words && !copy.isInline() && big.isInline(), "swapping inline and heap lists");
+    const small_list<std::string, 2> moved = std::move(copy);
+    check(moved.size() == 4 && moved[3] == "4", "moving a heap small list");
+
+    small_list<int, 4> numbers{ 4, 2, 3, 1 };
+    check(numbers.sort().slice(1, 2) == small_list<int, 4>{ 2, 3 } && numbers.reverse().front() == 4, "sort, slice and reverse");
+    check(numbers.count(3) == 1 && numbers.select([](int n) -> bool { return n > 2; }) == small_list<int, 4>{ 3, 4 }, "view operations on a small list");
+    numbers.resize(6, 9);
+    check(numbers.size() == 6 && numbers.back() == 9 && !numbers.isInline(), "resize past the inline capacity");
+    numbers.clear();
+    check(numbers.empty(), "clear");
+
+    small_list<int, 4> digits{ 3, 1, 3, 2 };
+    check(digits.removeAll(3) == small_list<int, 4>{ 1, 2 } && digits.removeFirst(3) == small_list<int, 4>{ 1, 3, 2 }, "removeAll and removeFirst on a small list");
+    check(digits.replace(7, 3) == small_list<int, 4>{ 7, 1, 7, 2 } && digits.replace([](int n) -> int { return n * 10; }, [](int n) -> bool { return n < 3; }) == small_list<int, 4>{ 3, 10, 3, 20 }, "replace on a small list");
+    check(digits.unify({ 2, 5 }) == small_list<int, 4>{ 3, 1, 2, 5 } && digits.disjoin({ 2, 4, 3 }) == small_list<int, 4>{ 2, 3 }, "unify and disjoin on a small list");
+    check(digits + 4 == small_list<int, 4>{ 3, 1, 3, 2, 4 } && (digits + digits).size() == 8 && !(digits + digits).isInline(), "concatenating small lists");
+    digits += digits;
+    digits.removeAllInPlace(3).replaceInPlace(9, 1);
+    check(digits == small_list<int, 4>{ 9, 2, 9, 2 } && digits.selectInPlace(9).removeFirstInPlace(9) == small_list<int, 4>{ 9 }, "in-place operations on a small list");
+
+    small_list<C, 2> objects{ C(3), C(-1), C(2), C(-3) };
+    check(objects.removeAll(3, &C::get) == small_list<C, 2>{ C(-1), C(2), C(-3) } && objects.removeFirst(2, &C::getDiff, 0).size() == 3, "removing by member on a small list");
+    objects.stableSort(&C::getDiff, 0);
+    check(objects == small_list<C, 2>{ C(-1), C(2), C(3), C(-3) }, "stableSort by member on a small list");
+    objects.sort(std::greater<>{}, &C::n);
+    check(objects == small_list<C, 2>{ C(3), C(2), C(-1), C(-3) } && objects.replace(C(0), 2, &C::get)[1] == C(0), "sort by member and replace by member on a small list");
+}
+
+// Whether the text ends with the given elements, after the list's type name
+bool formatsAs(const std::string& text, const std::string& elements)
+{
+    return text.size() >= elements.size() && text.compare(text.size() - elements.size(), elements.size(), elements) == 0;
+}
+
+void testFormatting()
+{
+    const list<int> numbers{ 1, -2, 30 };
+    std::ostringstream stream;
+    stream << numbers;
+    check(stream.str() == (std::string)numbers && formatsAs(stream.str(), "(1, -2, 30)"), "stream and string conversion agree");
+    check(formatsAs(numbers.format(" "), "(1 -2 30)") && formatsAs(numbers.format(", ", 1), "(1, ... (2 more))"), "format with a separator and a limit");
+    check(formatsAs(list<double>{ 0.5, -0.0 }.format(), "(0.5, -0)") && formatsAs(list<C>{ C(3) }.format(), "(3)"), "formatting doubles and convertible objects");
+
+    char buffer[64];
+    const auto written = numbers.formatTo(buffer, buffer + sizeof(buffer), "|");
+    check(written.ec == std::errc() && formatsAs(std::string(buffer, written.ptr), "(1|-2|30)"), "formatTo a buffer");
+    const auto overflow = numbers.formatTo(buffer, buffer + 4);
+    check(overflow.ec == std::errc::value_too_large && overflow.ptr == buffer + 4, "formatTo a buffer too small");
+
+    std::wostringstream wide;
+    numbers.formatTo(wide, L"; ");
+    check(wide.str().find(L"(1; -2; 30)") != std::wstring::npos, "formatTo a wide stream");
+
+    const list<int> empty;
+    check(formatsAs(empty.format(), ": ()") && formatsAs(list<int>{ 7 }.format(), ": (7)") && formatsAs(numbers.format(", ", 0), ": (... (3 more))"), "formatting empty and single-element lists");
+}
+
+// A stream buffer which, like a pipe, can't say how long it is
+class Unseekable : public std::stringbuf
+{
+public:
+    using std::stringbuf::stringbuf;
+
+protected:
+    pos_type seekoff(off_type, std::ios::seekdir, std::ios::openmode) override { return pos_type(off_type(-1)); }
+    pos_type seekpos(pos_type, std::ios::openmode) override { return pos_type(off_type(-1)); }
+};
+
+// Whether loading the given bytes as a list of ints fails with std::runtime_error, from a stream that can seek and from one that can't
+bool loadFails(const std::string& bytes)
+{
+    std::istringstream stream(bytes, std::ios::binary);
+    try { (void)list<int>::load(stream); }
+    catch (const std::runtime_error&)
+    {
+        Unseekable buffer(bytes, std::ios::in | std::ios::binary);
+        std::istream pipe(&buffer);
+        try { (void)list<int>::load(pipe); }
+        catch (const std::runtime_error&) { return true; }
+    }
+    return false;
+}
+
+void testSaveLoad()
+{
+    const list<int> numbers{ 3, -1, 4, 1, -5, 9 };
+    std::ostringstream saved(std::ios::binary);
+    numbers.save(saved);
+    const std::string bytes = saved.str();
+    std::istringstream reading(bytes, std::ios::binary);
+    check(list<int>::load(reading) == numbers, "save and load round trip");
+    Unseekable pipeBuffer(bytes, std::ios::in | std::ios::binary);
+    std::istream pipe(&pipeBuffer);
+    check(list<int>::load(pipe) == numbers, "loading from a stream which can't seek");
+
+    for (const list<int>& edge : { list<int>(), list<int>{ 42 } })
+    {
+        std::ostringstream out(std::ios::binary);
+        edge.save(out);
+        std::istringstream in(out.str(), std::ios::binary);
+        check(list<int>::load(in) == edge, "save and load empty and single-element lists");
+    }
+
+    std::string corrupt = bytes;
+    corrupt.back() ^= 0x20;
+    check(loadFails(bytes.substr(0, bytes.size() - 1)) && loadFails(bytes.substr(0, 10)) && loadFails(""), "loading a truncated list throws");
+    check(loadFails(corrupt) && loadFails(std::string(bytes.size(), 'x')), "loading a corrupt list throws");
+    std::string huge = bytes;
+    const std::uint64_t hugeCount = (std::uint64_t)1 << 40;
+    std::memcpy(&huge[16], &hugeCount, sizeof(hugeCount));   // after the magic, version, data offset and element size
+    check(loadFails(huge), "loading a list whose count is far past the data throws, without allocating for it");
+    std::istringstream wrongType(bytes, std::ios::binary);
+    bool threw = false;
+    try { (void)list<double>::load(wrongType); }
+    catch (const std::runtime_error&) { threw = true; }
+    check(threw, "loading a list of another element type throws");
+
+    const std::string path = "tester_saved.bin";
+    numbers.save(path);
+    {
+        const mapped_list<int> mapped(path);
+        check(mapped.size() == numbers.size() && mapped.toList() == numbers && mapped.verify() && mapped.max() == 9, "mapping a saved list");
+    }
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(corrupt.data(), (std::streamsize)corrupt.size());
+    {
+        const mapped_list<int> mapped(path);
+        check(!mapped.verify(), "verify finds a corrupt mapped list");
+    }
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), (std::streamsize)bytes.size() - 3);
+    threw = false;
+    try { const mapped_list<int> mapped(path); }
+    catch (const std::runtime_error&) { threw = true; }
+    check(threw, "mapping a truncated list throws");
+    std::remove(path.c_str());
+}
+
+void testInstrumentation()
+{
+    counted_list<int> numbers;
+    for (int i = 0; i < 10; i++)
+        numbers.push_back(i);
+    const auto small = [](int n) -> bool { return n < 3; };
+
+    counted_list<int> selected;
+    const instrumentation::counters cost = instrumentation::measure([&]() -> void { selected = numbers.select(instrumentation::count_calls(small)); });
+    check(selected.size() == 3, "an instrumented select gives the same result");
+    if (instrumentation::enabled)
+        check(cost.invocations == 10 && cost.copies >= 3 && cost.allocations >= 1, "instrumentation counts calls, copies and allocations");
+    else
+        check(cost.invocations == 0 && cost.copies == 0 && cost.allocations == 0, "counts are zero without instrumentation");
+
+    {
+        instrumentation::scope site("tester");
+        (void)numbers.count(instrumentation::count_calls(small));
+    }
+    check(instrumentation::enabled ? instrumentation::report()["tester"].invocations == 10 : instrumentation::report().empty(), "scopes add up their counts");
+    instrumentation::resetReport();
+    check(instrumentation::report().empty(), "resetReport clears the totals");
+
+    const counted_list<int> empty;
+    const instrumentation::counters none = instrumentation::measure([&]() -> void { (void)empty.select(small); });
+    check(none.invocations == 0 && none.copies == 0, "an operation on an empty list costs nothing");
+}
+
+void testShuffle()
+{
+    list<int> numbers;
+    for (int i = 0; i < 1000; i++)
+        numbers.push_back(i);
+    const auto isPermutation = [&numbers](list<int> shuffled) -> bool { return shuffled.sort() == numbers; };
+
+    const list<int> seeded = list<int>(numbers).shuffle(12345);
+    check(seeded == list<int>(numbers).shuffle(12345) && seeded != list<int>(numbers).shuffle(54321), "the same seed gives the same order");
+    check(isPermutation(seeded) && seeded != numbers, "a shuffle is a permutation");
+    std::mt19937 first(7);
+    std::mt19937 second(7);
+    check(list<int>(numbers).shuffle(first) == list<int>(numbers).shuffle(second), "shuffling with a generator of your own");
+    check(list<int>(numbers).partialShuffle(10, 99).slice(0, 10) == list<int>(numbers).shuffle(99).slice(0, 10), "a partial shuffle fills its positions as a full one would");
+    check(isPermutation(list<int>(numbers).partialShuffle(10, 99)), "a partial shuffle is a permutation");
+
+    list<int> big;
+    for (int i = 0; i < 200000; i++)
+        big.push_back(i);
+    thread_pool& pool = thread_pool::shared();
+    const size_t workers = pool.workers();
+    pool.configure(1);
+    const list<int> onFew = list<int>(big).shuffleParallel(3);
+    pool.configure(3);
+    const list<int> onMore = list<int>(big).shuffleParallel(3);
+    pool.configure(workers);
+    check(onFew == onMore && onFew != big && list<int>(onFew).sort() == big, "a parallel shuffle gives the same order on any number of threads");
+
+    check(list<int>().shuffle(1).empty() && list<int>().shuffleParallel(1).empty() && list<int>().partialShuffle(3, 1).empty(), "shuffling an empty list");
+    check(list<int>{ 5 }.shuffle(1) == list<int>{ 5 } && list<int>{ 5 }.partialShuffle(3, 1) == list<int>{ 5 }, "shuffling one element");
+}
+
+void testSample()
+{
+    list<Keyed> items;
+    for (int i = 0; i < 500; i++)
+        items.push_back({ i % 4, i });
+    const auto inOrder = [](const list<Keyed>& sample) -> bool {
+        for (size_t i = 1; i < sample.size(); i++)
+        {
+            if (sample[(long)i - 1].order >= sample[(long)i].order)
+                return false;
+        }
+        return true;
+    };
+    const auto weigh = [](const Keyed& item) -> double { return item.key; };
+
+    const list<Keyed> seeded = items.sample(20, 42);
+    check(seeded.size() == 20 && inOrder(seeded), "a sample keeps the original order");
+    check(seeded.transform<int>(&Keyed::order) == items.sample(20, 42).transform<int>(&Keyed::order), "the same seed gives the same sample");
+    check(items.sample(20, &Keyed::key, 42).transform<int>(&Keyed::order) == items.sample(20, &Keyed::key, 42).transform<int>(&Keyed::order), "the same seed gives the same weighted sample");
+    check(items.sample(100, weigh, 5).count(0, &Keyed::key) == 0, "elements of weight zero are never chosen");
+    std::mt19937 first(3);
+    std::mt19937 second(3);
+    check(items.sample(10, weigh, first).transform<int>(&Keyed::order) == items.sample(10, weigh, second).transform<int>(&Keyed::order), "weighted sampling with a generator of your own");
+    check(items.lazy().sample(15, 8).transform<int>(&Keyed::order) == items.lazy().sample(15, 8).transform<int>(&Keyed::order), "the same seed gives the same pipeline sample");
+    check(items.sliceView(100, 50).sample(10, 1).size() == 10 && items.sample(1000, 1).size() == items.size(), "sampling views, and more than there is");
+
+    const list<Keyed> empty;
+    check(empty.sample(3, 1).empty() && empty.sample(3, weigh, 1).empty() && items.sample(0, 1).empty(), "sampling an empty list, and sampling none");
+    const list<Keyed> one{ { 1, 0 } };
+    check(one.sample(3, 1).size() == 1 && one.sample(1, &Keyed::key, 1).size() == 1, "sampling one element");
+}
+
+void testHashIndex()
+{
+    list<Keyed> items{ { 1, 0 }, { 2, 1 }, { 1, 2 } };
+    auto byKey = items.index(&Keyed::key);
+    check(byKey.count(1) == 2 && byKey.contains(2) && !byKey.contains(3) && byKey.keys() == 2, "lookups by key");
+    check(byKey.search(1) == items.begin() && byKey.search(3) == byKey.npos(), "search finds the first match");
+    check(byKey.select(1).transform<int>(&Keyed::order) == list<int>{ 0, 2 }, "select keeps the list's order");
+
+    items.push_back({ 3, 3 });
+    check(byKey.stale() && !byKey.contains(3), "lookups answer for the list as last indexed");
+    byKey.refresh();
+    check(!byKey.stale() && byKey.contains(3) && byKey.count(1) == 2, "refresh indexes appended elements");
+
+    items.sort(std::greater<>{}, &Keyed::key);
+    byKey.rebuild();
+    check(byKey.search(3) == items.begin() && byKey.select(1).size() == 2, "rebuild after sorting");
+    items.removeAllInPlace(1, &Keyed::key);
+    items.shrink_to_fit();
+    check(byKey.stale(), "a shorter list makes the index stale");
+    bool threw = false;
+    try { (void)byKey.contains(1); }
+    catch (const std::logic_error&) { threw = true; }
+    check(threw, "lookups on a list shorter than when it was indexed throw");
+    check(sizeof(items) == sizeof(std::vector<Keyed>), "an index keeps nothing in the list");
+    byKey.refresh();
+    check(!byKey.stale() && byKey.count(1) == 0 && byKey.keys() == 2 && byKey.search(2) == items.begin() + 1, "refresh after removing indexes again");
+
+    items[0].key = 9;
+    byKey.rebuild();
+    check(byKey.contains(9) && !byKey.contains(3), "rebuild sees elements written in place");
+
+    const auto byMethod = items.index(&Keyed::getKey);
+    const auto byFunction = items.index([](const Keyed& item) -> int { return item.order % 2; });
+    check(byMethod.contains(9) && byFunction.count(1) == 2, "indexing by method and by function");
+
+    list<Keyed> empty;
+    auto none = empty.index(&Keyed::key);
+    check(!none.contains(0) && none.search(0) == none.npos() && none.keys() == 0, "an index of an empty list");
+    empty.push_back({ 4, 0 });
+    none.refresh();
+    check(none.count(4) == 1 && none.select(4).size() == 1, "an index of one element");
+}
+
 int main()
 {
     const list<int> l1{ 10, 5, -3, 0, 11, 5 };
     std::cout << l1.max() << " " << l1.min() << "\n";
-    return 0;
+
+    testSets();
+    testPipelines();
+    testQuantifiers();
+    testInPlace();
+    testRvalues();
+    testSortByMember();
+    testParallel();
+    testThreadPool();
+    testSimd();
+    testExtremes();
+    testRadixSort();
+    testSortedList();
+    testGenerators();
+    testSubstrings();
+    testViews();
+    testRemoveAt();
+#ifdef EASY_LIST_PMR
+    testAllocators();
+#endif
+    testSmallList();
+    testFormatting();
+    testSaveLoad();
+    testInstrumentation();
+    testShuffle();
+    testSample();
+    testHashIndex();
+
+    std::cout << (failures == 0 ? "All checks passed" : "Some checks failed") << "\n";
+    return failures == 0 ? 0 : 1;
 }